@@ -809,7 +809,39 @@
   #define DEFAULT_bedKd 305.4
 
   // FIND YOUR OWN: "M303 E-1 C8 S90" to run autotune on the bed at 90 degreesC for 8 cycles.
-#else
+#endif
+
+/**
+ * Model Predictive Control for the bed
+ *
+ * Use a physical model of the bed to reach and hold the target with little overshoot,
+ * so M190 returns sooner. The model's exponential terms are precomputed whenever the
+ * constants change, so it costs only a few multiply-adds per sample.
+ * Enable MPC_BED_AUTOTUNE and use 'M306 E-1 T' to autotune the model.
+ * Not compatible with PIDTEMPBED.
+ */
+//#define MPCTEMPBED
+#if ENABLED(MPCTEMPBED)
+  #define MPC_BED_AUTOTUNE                      // Include a method to do bed MPC auto-tuning
+  #define MPC_BED_HEATER_POWER         250.0f   // (W) Bed heater power at full duty
+  #define MPC_BED_HEAT_CAPACITY        800.0f   // (J/K) Bed heat capacity
+  #define MPC_BED_SENSOR_RESPONSIVENESS 0.05f   // (K/s per ∆K) Rate of change of sensor temperature from the bed
+  #define MPC_BED_AMBIENT_XFER_COEFF     1.2f   // (W/K) Heat transfer coefficient from the bed to room air
+
+  // Advanced options
+  #define MPC_BED_HORIZON               20.0f   // (s) Time in which the model plans to reach the target
+  #define MPC_BED_SMOOTHING_FACTOR       0.5f   // (0.0...1.0) Noisy temperature sensors may need a lower value for stabilization.
+  #define MPC_BED_MIN_AMBIENT_CHANGE     0.1f   // (K/s) Modeled ambient temperature rate of change, when correcting model inaccuracies.
+  #define MPC_BED_STEADYSTATE            0.1f   // (K/s) Temperature change rate for steady state logic to be enforced.
+
+  #if ENABLED(MPC_BED_AUTOTUNE)
+    #define MPC_BED_TUNING_TEMP           70    // (°C) M306 E-1 T tuning temperature
+    #define MPC_BED_TUNING_SETTLE_MS   60000UL  // (ms) Settling time at the tuning temperature
+    #define MPC_BED_TUNING_TEST_MS     60000UL  // (ms) Heat loss measurement time
+  #endif
+#endif
+
+#if NONE(PIDTEMPBED, MPCTEMPBED)
   //#define BED_LIMIT_SWITCHING   // Keep the bed temperature within BED_HYSTERESIS of the target
 #endif
 
@@ -2238,7 +2270,7 @@
   //#define MESH_EDIT_GFX_OVERLAY   // Display a graphics overlay while editing the mesh
 
   #define MESH_INSET 1              // Set Mesh bounds as an inset region of the bed
-  #define GRID_MAX_POINTS_X 10      // Don't use more than 15 points per axis, implementation limited.
+  #define GRID_MAX_POINTS_X 10      // For large grids enable QUANTIZED_MESH to save SRAM
   #define GRID_MAX_POINTS_Y GRID_MAX_POINTS_X
 
   //#define UBL_HILBERT_CURVE       // Use Hilbert distribution for less travel when probing multiple points
@@ -2455,6 +2487,7 @@
 #if ENABLED(EEPROM_SETTINGS)
   //#define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
   //#define EEPROM_INIT_NOW   // Init EEPROM on first boot after a new build.
+  //#define FLASH_EEPROM_JOURNAL // With FLASH_EEPROM_LEVELING (STM32F4/H7) save only changed data, for a faster M500 and less flash wear
 #endif
 
 // @section host
@@ -3476,6 +3509,15 @@
 
   //#define TFT_SHARED_IO   // I/O is shared between TFT display and other devices. Disable async data transfer.
 
+  //#define TFT_QUEUE_DMA_CHAINING  // Start queued fills from the DMA completion interrupt. STM32 FSMC/SPI only.
+                                    // An F4 TFT on SPI1 with SDIO_SUPPORT is polled (SDIO owns the interrupt).
+
+  //#define TFT_GLYPH_CACHE           // Keep recently drawn glyphs expanded to pixels for faster text drawing
+  #if ENABLED(TFT_GLYPH_CACHE)
+    #define TFT_GLYPH_CACHE_SIZE    16 // (glyphs) Uses TFT_GLYPH_CACHE_SIZE * TFT_GLYPH_CACHE_PIXELS * 2 bytes of RAM
+    #define TFT_GLYPH_CACHE_PIXELS 512 // (pixels) Largest glyph (width * height) to cache. Bigger glyphs are drawn directly.
+  #endif
+
   #define COMPACT_MARLIN_BOOT_LOGO  // Use compressed data to save Flash space
 #endif
 
@@ -3677,6 +3719,13 @@
   //#define NEOPIXEL_BKGD_COLOR         { 255, 255, 255, 0 }  // R, G, B, W
   //#define NEOPIXEL_BKGD_TIMEOUT_COLOR {  25,  25,  25, 0 }  // R, G, B, W
   //#define NEOPIXEL_BKGD_ALWAYS_ON       // Keep the backlight on when other NeoPixels are off
+
+  // Send the strip with timer PWM and DMA so long strips don't hold off interrupts. (STM32F1/F4 only)
+  // NEOPIXEL_PIN must be a PWM pin of TIM1, TIM3, TIM4, TIM8 (or TIM2, TIM5 on STM32F1), and no other
+  // PWM output may use the same timer. The Stepper, Temperature, tone and servo timers are refused,
+  // as is a DMA channel used by the TFT or SERIAL_DMA. Otherwise the strip is bit-banged as usual.
+  // The frame buffer takes 48 bytes of RAM per pixel (64 with white) plus 482 bytes, e.g., 7.4K for 144 RGB pixels.
+  //#define NEOPIXEL_DMA
 #endif
 
 /**
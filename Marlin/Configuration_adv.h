@@ -568,6 +568,15 @@
 #define TEMP_SENSOR_AD8495_OFFSET 0.0
 #define TEMP_SENSOR_AD8495_GAIN   1.0
 
+/**
+ * Batch ADC sampling
+ * Accumulate all thermistor (and joystick) channels in a single Temperature ISR pass
+ * instead of a Prepare/Measure pair of passes per sensor. Requires a HAL that converts
+ * every channel continuously in the background (DMA / burst mode: STM32F1, LPC176x).
+ * Reduces the Temperature ISR load on machines with many sensors.
+ */
+//#define TEMP_ADC_BATCH_SAMPLING
+
 // @section fans
 
 /**
@@ -1063,7 +1072,8 @@
 
   /**
    * Z Stepper positions for more rapid convergence in bed alignment.
-   * Requires 3 or 4 Z steppers.
+   * A plane fitted through the probe points (a line, with 2 Z steppers) gives
+   * the correction for each stepper, so G34 should converge in one iteration.
    *
    * Define Stepper XY positions for Z1, Z2, Z3... corresponding to the screw
    * positions in the bed carriage, with one position per Z stepper in stepper
@@ -1149,6 +1159,15 @@
 
   //#define FT_MOTION_MENU                        // Provide a MarlinUI menu to set M493 parameters
 
+  /**
+   * Stream inline laser power (M3 I / M4 I) along with the FT Motion trajectory.
+   * Power is updated once per trajectory point and passes through the same shaper
+   * as X/Y, so it stays aligned with the shaped path. M4 I (Dynamic) mode and
+   * LASER_POWER_TRAP scale the power with the instantaneous speed.
+   * Requires LASER_FEATURE.
+   */
+  //#define FTM_LASER_POWER
+
   /**
    * Advanced configuration
    */
@@ -1304,6 +1323,11 @@
   // Set BACKLASH_SMOOTHING_MM to spread backlash correction over multiple segments
   // to reduce print artifacts. (Enabling this is costly in memory and computation!)
   //#define BACKLASH_SMOOTHING_MM 3 // (mm)
+  #ifdef BACKLASH_SMOOTHING_MM
+    // Take up each correction at a constant rate, finishing within BACKLASH_SMOOTHING_MM,
+    // instead of taking a shrinking share of the remaining error in every segment.
+    //#define BACKLASH_SMOOTHING_LINEAR
+  #endif
 
   // Add runtime configuration and tuning of backlash values (M425)
   //#define BACKLASH_GCODE
@@ -1787,6 +1811,12 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE    0.05 // (mm) Minimum Z change before saving power-loss data
 
+    // Write power-loss data in the background, one SD sector per idle() pass (so also while
+    // waiting in a pause), alternating between two slots in the recovery file so a torn write
+    // is never loaded.
+    // Keeps the recovery file open while printing. Recommended with SAVE_EACH_CMD_MODE.
+    //#define POWER_LOSS_ASYNC_WRITE
+
     //#define BACKUP_POWER_SUPPLY           // Backup power / UPS to move the steppers on power-loss
     #if ENABLED(BACKUP_POWER_SUPPLY)
       //#define POWER_LOSS_RETRACT_LEN   10 // (mm) Length of filament to retract on fail
@@ -1936,6 +1966,16 @@
   #if ENABLED(BINARY_FILE_TRANSFER)
     // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
     //#define CUSTOM_FIRMWARE_UPLOAD
+
+    // Largest heatshrink window a host may use for compressed uploads, costing 2^BITS bytes of SRAM.
+    // A larger window compresses G-code better. The host may request a smaller window when opening a file.
+    //#define BINARY_STREAM_WINDOW_BITS     8 // (4..15)
+    //#define BINARY_STREAM_LOOKAHEAD_BITS  4 // Default lookahead (3..WINDOW_BITS-1)
+
+    // 512-byte buffers for upload data. With 2 or more (the default), full buffers are written
+    // to SD between packets, overlapping the SD write with receiving the next packet.
+    // Set to 1 to save SRAM at the cost of a blocking SD write in the middle of a packet.
+    //#define BINARY_STREAM_WRITE_BUFFERS   2 // (1..8)
   #endif
 
   /**
@@ -1997,6 +2037,11 @@
   // Western only. Not available for Cyrillic, Kana, Turkish, Greek, or Chinese.
   //#define USE_SMALL_INFOFONT
 
+  // Only send display pages whose CRC changed since the last refresh. Most of the Info Screen
+  // stays the same, so this cuts SPI/I2C traffic and the time spent on it. Pages are still
+  // drawn every refresh, so drawing time is unchanged. Costs ~70 bytes of SRAM.
+  //#define DOGM_SKIP_UNCHANGED_PAGES
+
   /**
    * ST7920-based LCDs can emulate a 16 x 4 character display using
    * the ST7920 character-generator for very fast screen updates.
@@ -2446,6 +2491,16 @@
   //#define OPTIMIZED_MESH_STORAGE  // Store mesh with less precision to save EEPROM space
 #endif
 
+/**
+ * Keep the mesh in RAM as 16-bit micrometer values instead of floats.
+ * Halves mesh SRAM and EEPROM use so larger grids (e.g., 24x24) will fit.
+ * Z values are clamped to ±32.766mm with 0.001mm resolution.
+ * Not compatible with MESH_EDIT_MENU, ProUI, JyersUI, or EXTENSIBLE_UI.
+ */
+#if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+  //#define QUANTIZED_MESH
+#endif
+
 /**
  * Repeatedly attempt G29 leveling until it succeeds.
  * Stop after G29_MAX_RETRIES attempts.
@@ -2658,6 +2713,11 @@
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
 
+// Accumulate serial input directly in the free command queue slot instead of
+// a separate line buffer, saving a copy per byte and MAX_CMD_SIZE bytes of SRAM.
+// Requires a single serial port. Not compatible with BINARY_FILE_TRANSFER.
+//#define SERIAL_DIRECT_QUEUE
+
 /**
  * Host Transmit Buffer Size
  *  - Costs 386 bytes of flash and TX_BUFFER_SIZE+3 bytes of SRAM (if not 0).
@@ -2740,6 +2800,23 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+/**
+ * Sliding-window flow control
+ * After 'M110 W<lines>' the host may send up to that many numbered lines ahead
+ * without waiting for each "ok". Replies are coalesced into a cumulative "ok N<line>"
+ * sent every half window, or sooner when no more host lines are queued.
+ * After a resend request, lines already in flight are dropped quietly until the
+ * requested line arrives. 'M110 W0' restores one "ok" per line.
+ * An M110 without W, or a host disconnect, also ends the window.
+ *
+ * The window can't be larger than the command queue, so raise BUFSIZE to
+ * pipeline more lines. With the default BUFSIZE of 4 the gain is small.
+ */
+//#define SERIAL_WINDOW_ACK
+#if ENABLED(SERIAL_WINDOW_ACK)
+  #define SERIAL_WINDOW_MAX BUFSIZE // (lines) Largest window. No more than BUFSIZE + RX_BUFFER_SIZE / MAX_CMD_SIZE.
+#endif
+
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
 #define SERIAL_OVERRUN_PROTECTION
@@ -3393,6 +3470,7 @@
    * for error conditions like overtemperature and short to ground.
    * To manage over-temp Marlin can decrease the driver current until the error condition clears.
    * Other detected conditions can be used to stop the current print.
+   * Drivers are polled one axis per idle() call to avoid stalling the command queue.
    * Relevant G-codes:
    * M906 - Set or get motor current in milliamps using axis codes X, Y, Z, E. Report values if no axis codes given.
    * M911 - Report stepper driver overtemperature pre-warn condition.
@@ -3597,6 +3675,31 @@
   // Duration to hold the switch or keep CHDK_PIN high
   //#define PHOTO_SWITCH_MS   50 // (ms) (M240 D)
 
+  // With I2C_POSITION_ENCODERS and CHDK_PIN or PHOTOGRAPH_PIN, trigger as soon as the encoders
+  // report all axes on target and at rest, instead of waiting out a fixed dwell.
+  //#define PHOTO_ENCODER_SETTLE
+  #if ENABLED(PHOTO_ENCODER_SETTLE)
+    #define PHOTO_SETTLE_ERROR_MM     0.05 // (mm) Maximum measured position error
+    #define PHOTO_SETTLE_SPEED_MM_S   0.5  // (mm/s) Maximum measured axis speed
+    #define PHOTO_SETTLE_TIMEOUT_MS   2000 // (ms) Skip the photo if the axes don't settle in time (M240 W)
+    #define PHOTO_SETTLE_EXPOSURE_MS     0 // (ms) Axes must stay at rest this long after the trigger...
+    #define PHOTO_SETTLE_RETRIES         1 // ...or the blurred photo is retaken up to this many times
+  #endif
+
+  // Strobe a light with each photo so no M150 / M355 round trips are needed around M240.
+  // Requires CHDK_PIN or PHOTOGRAPH_PIN. The pin must be a plain digital output. If it's the
+  // CASE_LIGHT_PIN the case light is restored afterward (requires CASE_LIGHT_NO_BRIGHTNESS).
+  // STM32 times the edges to a few µs with a free basic timer (TIM7 or TIM6) or PHOTO_STROBE_TIMER.
+  // Otherwise the Temperature ISR (~1kHz) times them to ~1ms, so strobes under ~5ms are rejected.
+  //#define PHOTO_STROBE
+  #if ENABLED(PHOTO_STROBE)
+    #define PHOTO_STROBE_PIN         -1 // Light output pin, e.g., CASE_LIGHT_PIN
+    #define PHOTO_STROBE_STATE     HIGH // Pin state with the light on
+    #define PHOTO_STROBE_OFFSET_MS    0 // (ms) Delay from the start of the shutter trigger to the strobe (M240 O)
+    #define PHOTO_STROBE_WIDTH_MS    10 // (ms) Strobe duration (M240 L). At least ~5ms without a hardware timer.
+    //#define PHOTO_STROBE_TIMER      7 // STM32 timer (TIM#) to use. Must not be used by PWM pins.
+  #endif
+
   /**
    * PHOTO_PULSES_US may need adjustment depending on board and camera model.
    * Pin must be running at 48.4kHz.
@@ -3973,6 +4076,20 @@
   //#define AUTO_REPORT_REAL_POSITION // Auto-report the real position
 #endif
 
+/**
+ * Compact binary status reports with M156 S<ms> P<sections>
+ * Hosts that find BINARY_REPORTS in M115 can poll temperatures, position,
+ * buffer and endstop states at up to 100Hz without crowding out command acks.
+ * See feature/binary_report.h for the frame format.
+ */
+//#define BINARY_REPORTS
+#if ENABLED(BINARY_REPORTS)
+  //#define POSITION_TELEMETRY            // M156 T<Hz> streams timestamped stepper positions sampled in the temperature ISR
+  #define POSITION_TELEMETRY_BUFFER 16    // Samples held between idle() calls. A power of 2 up to 128.
+  //#define BINARY_MESH                   // M157 sends the bed mesh with its grid, temperatures and timestamp for host-side meshing. M48 B sends the probe samples.
+  #define BINARY_MESH_FILE "MESH.BIN"     // M157 S saves the mesh frames to this file on the media. M157 L loads them.
+#endif
+
 /**
  * M115 - Report capabilites. Disable to save ~1150 bytes of flash.
  *        Some hosts (and serial TFT displays) rely on this feature.
@@ -4275,6 +4392,12 @@
    */
   #define I2CPE_MIN_UPD_TIME_MS     4                       // (ms) Minimum time between encoder checks.
 
+  // Check one encoder per update, in turn, so the main loop does a single short I2C read per pass
+  // no matter how many encoders are installed. Each encoder keeps a timestamped sample of its position.
+  // On STM32 the read is interrupt-driven, started on one pass and collected on the next, so the
+  // main loop never waits on the bus. Other platforms' Wire libraries only do blocking reads.
+  //#define I2CPE_ROUND_ROBIN_UPDATE
+
   // Use a rolling average to identify persistent errors that indicate skips, as opposed to vibration and noise.
   #define I2CPE_ERR_ROLLING_AVERAGE
 
@@ -50,8 +50,8 @@ int freeMemory() { return 0; }
 
 uint8_t MarlinHAL::active_ch = 0;
 
-uint16_t MarlinHAL::adc_value() {
-  const pin_t pin = analogInputToDigitalPin(active_ch);
+uint16_t MarlinHAL::adc_read(const uint8_t ch) {
+  const pin_t pin = analogInputToDigitalPin(ch);
   if (!isValidPin(pin)) return 0;
   return uint16_t((Gpio::get(pin) >> 2) & 0x3FF); // return 10bit value as Marlin expects
 }
@@ -87,6 +87,7 @@ extern MSerialT usb_serial;
 // ADC
 #define HAL_ADC_VREF_MV   5000
 #define HAL_ADC_RESOLUTION  10
+#define HAL_ADC_CONTINUOUS      // Simulated ADC values can be read at any time
 
 // ------------------------
 // Class Utilities
@@ -156,7 +157,10 @@ public:
   static bool adc_ready() { return true; }
 
   // The current value of the ADC register
-  static uint16_t adc_value();
+  static uint16_t adc_value() { return adc_read(active_ch); }
+
+  // The current value of the given channel
+  static uint16_t adc_read(const uint8_t ch);
 
   /**
    * Set the PWM duty cycle for the pin to the given value.
@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Simulated SPI bus for the Linux HAL.
+ *
+ * No devices are attached, so reads return 0xFF as from an idle MISO line.
+ * This lets SD support build natively, e.g., for the binary file transfer
+ * unit tests, with card.mount() failing as it would with no card inserted.
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "../shared/HAL_SPI.h"
+
+void spiBegin() {}
+void spiInit(uint8_t) {}
+void spiSend(uint8_t) {}
+uint8_t spiRec() { return 0xFF; }
+void spiRead(uint8_t *buf, uint16_t nbyte) { memset(buf, 0xFF, nbyte); }
+void spiSendBlock(uint8_t, const uint8_t*) {}
+void spiBeginTransaction(uint32_t, uint8_t, uint8_t) {}
+
+void spiSend(uint32_t, byte) {}
+void spiSend(uint32_t, const uint8_t*, size_t) {}
+uint8_t spiRec(uint32_t) { return 0xFF; }
+
+#endif // __PLAT_LINUX__
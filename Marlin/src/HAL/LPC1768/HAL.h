@@ -74,6 +74,7 @@ extern "C" volatile uint32_t _millis;
 
 #define HAL_ADC_RESOLUTION     12   // 15 bit maximum, raw temperature is stored as int16_t
 #define HAL_ADC_FILTERED            // Disable oversampling done in Marlin as ADC values already filtered in HAL
+#define HAL_ADC_CONTINUOUS          // All enabled ADC channels are converted continuously in burst mode
 
 //
 // Pin Mapping for M42, M43, M226
@@ -199,6 +200,11 @@ public:
     return uint16_t(adc_result);
   }
 
+  // Latest filtered burst-mode value for the given pin. Safe to call from Temperature::isr.
+  static uint16_t adc_read(const pin_t pin) {
+    return uint16_t(FilteredADC::read(pin) >> (16 - HAL_ADC_RESOLUTION));
+  }
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * Optionally invert the duty cycle [default = false]
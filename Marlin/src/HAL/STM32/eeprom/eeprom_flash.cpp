@@ -86,7 +86,9 @@
   #define EMPTY_UINT8             ((uint8_t)-1)
 
   static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4))) = {0};
-  static int current_slot = -1;
+  #if DISABLED(FLASH_EEPROM_JOURNAL)
+    static int current_slot = -1;
+  #endif
 
   static_assert(0 == MARLIN_EEPROM_SIZE % FLASHWORD_SIZE, "MARLIN_EEPROM_SIZE must be a multiple of the FLASHWORD size"); // Ensure copying as uint32_t is safe
   static_assert(0 == FLASH_UNIT_SIZE % MARLIN_EEPROM_SIZE, "MARLIN_EEPROM_SIZE must divide evenly into your FLASH_UNIT_SIZE");
@@ -94,6 +96,139 @@
   static_assert(IS_FLASH_SECTOR(FLASH_SECTOR), "FLASH_SECTOR is invalid");
   static_assert(IS_POWER_OF_2(FLASH_UNIT_SIZE), "FLASH_UNIT_SIZE should be a power of 2, please check your chip's spec sheet");
 
+  static bool erase_flash_sector() {
+    FLASH_EraseInitTypeDef EraseInitStruct;
+    uint32_t SectorError = 0;
+
+    EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
+    EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    EraseInitStruct.Sector = FLASH_SECTOR;
+    EraseInitStruct.NbSectors = 1;
+
+    TERN_(HAS_PAUSE_SERVO_OUTPUT, PAUSE_SERVO_OUTPUT());
+    hal.isr_off();
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
+    hal.isr_on();
+    TERN_(HAS_PAUSE_SERVO_OUTPUT, RESUME_SERVO_OUTPUT());
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPGM("HAL_FLASHEx_Erase=", status);
+      DEBUG_ECHOLNPGM("GetError=", HAL_FLASH_GetError());
+      DEBUG_ECHOLNPGM("SectorError=", SectorError);
+      return false;
+    }
+    return true;
+  }
+
+  #if ENABLED(FLASH_EEPROM_JOURNAL)
+
+    /**
+     * The journal keeps the whole sector as a log of records, each holding a run of
+     * changed EEPROM blocks with its own CRC. Saving appends records for the blocks
+     * changed since the last save, so M500 programs a few words instead of a whole
+     * slot. Loading replays the records in order. When the sector is full it's
+     * erased and compacted into a single record holding the whole EEPROM image.
+     */
+    #define JOURNAL_MARKER        0x4A4C  // 'JL'
+    #define JOURNAL_BLOCK_SIZE    32U     // (bytes) Unit of change tracking. A multiple of FLASHWORD_SIZE.
+    #define JOURNAL_HEADER_SIZE   (FLASHWORD_SIZE > 8U ? FLASHWORD_SIZE : 8U)
+    #define JOURNAL_BLOCKS        ((MARLIN_EEPROM_SIZE) / (JOURNAL_BLOCK_SIZE))
+    #define JOURNAL_END           (FLASH_ADDRESS_END + 1)
+
+    typedef struct {
+      uint16_t marker, offset, length, crc;
+    } journal_header_t;
+
+    static uint8_t journal_dirty[(JOURNAL_BLOCKS + 7) / 8];
+    static uint32_t journal_address = 0;  // Address for the next record. Zero until the journal is replayed.
+
+    static_assert(0 == MARLIN_EEPROM_SIZE % JOURNAL_BLOCK_SIZE, "MARLIN_EEPROM_SIZE must be a multiple of 32 for FLASH_EEPROM_JOURNAL.");
+    static_assert(JOURNAL_HEADER_SIZE + MARLIN_EEPROM_SIZE <= FLASH_UNIT_SIZE, "FLASH_EEPROM_JOURNAL requires a FLASH_UNIT_SIZE larger than MARLIN_EEPROM_SIZE.");
+
+    static uint16_t journal_crc(const journal_header_t &header, const uint8_t *data) {
+      uint16_t crc = 0;
+      crc16(&crc, &header.offset, 2 * sizeof(uint16_t)); // Offset and length
+      crc16(&crc, data, header.length);
+      return crc;
+    }
+
+    static void journal_replay() {
+      for (int i = 0; i < MARLIN_EEPROM_SIZE; i++) ram_eeprom[i] = EMPTY_UINT8;
+      ZERO(journal_dirty);
+
+      uint32_t address = FLASH_ADDRESS_START;
+      uint16_t records = 0;
+      while (address + JOURNAL_HEADER_SIZE <= JOURNAL_END) {
+        const journal_header_t &header = *(journal_header_t *)address;
+        if (header.marker != JOURNAL_MARKER) break;
+        const uint8_t *data = (uint8_t *)(address + JOURNAL_HEADER_SIZE);
+        if (header.offset + header.length > MARLIN_EEPROM_SIZE
+          || address + JOURNAL_HEADER_SIZE + header.length > JOURNAL_END
+          || journal_crc(header, data) != header.crc
+        ) {
+          DEBUG_ECHOLNPGM("EEPROM journal record at ", address, " is corrupt.");
+          break;
+        }
+        memcpy(ram_eeprom + header.offset, data, header.length);
+        address += JOURNAL_HEADER_SIZE + header.length;
+        records++;
+      }
+
+      // Records can only go into erased flash. Anything left behind by an interrupted
+      // save (or by a different EEPROM layout) forces compaction on the next save.
+      journal_address = address;
+      for (; address < JOURNAL_END; address += sizeof(uint32_t))
+        if (*(__IO uint32_t*)address != EMPTY_UINT32) { journal_address = JOURNAL_END; break; }
+
+      DEBUG_ECHOLNPGM("EEPROM journal replayed ", records, " records.");
+    }
+
+    static bool journal_program(const uint32_t address, const uint8_t *data, const uint32_t length) {
+      for (uint32_t offset = 0; offset < length; offset += FLASHWORD_SIZE) {
+        #ifdef STM32H7xx
+          const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, address + offset, uint32_t(data + offset));
+        #else
+          const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address + offset, *(uint32_t*)(data + offset));
+        #endif
+        if (status != HAL_OK) {
+          DEBUG_ECHOLNPGM("HAL_FLASH_Program=", status);
+          DEBUG_ECHOLNPGM("GetError=", HAL_FLASH_GetError());
+          DEBUG_ECHOLNPGM("address=", address + offset);
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // Append a record for part of the EEPROM image. Return 'false' if it doesn't fit or programming failed.
+    static bool journal_append(const uint16_t offset, const uint16_t length) {
+      const uint32_t size = JOURNAL_HEADER_SIZE + length;
+      if (journal_address + size > JOURNAL_END) return false;
+
+      uint32_t header_words[JOURNAL_HEADER_SIZE / sizeof(uint32_t)];
+      memset(header_words, EMPTY_UINT8, sizeof(header_words));
+      journal_header_t &header = *(journal_header_t *)header_words;
+      header.marker = JOURNAL_MARKER;
+      header.offset = offset;
+      header.length = length;
+      header.crc = journal_crc(header, ram_eeprom + offset);
+
+      // Program the header last so an interrupted save never gets replayed
+      const bool success = journal_program(journal_address + JOURNAL_HEADER_SIZE, ram_eeprom + offset, length)
+                        && journal_program(journal_address, (uint8_t *)header_words, JOURNAL_HEADER_SIZE);
+      journal_address = success ? journal_address + size : JOURNAL_END;
+      return success;
+    }
+
+    // Erase the sector and start over with the whole EEPROM image
+    static bool journal_compact() {
+      DEBUG_ECHOLNPGM("EEPROM journal full. Compacting.");
+      if (!erase_flash_sector()) return false;
+      journal_address = FLASH_ADDRESS_START;
+      return journal_append(0, MARLIN_EEPROM_SIZE);
+    }
+
+  #endif // FLASH_EEPROM_JOURNAL
+
 #endif // FLASH_EEPROM_LEVELING
 
 static bool eeprom_data_written = false;
@@ -107,7 +242,15 @@ bool PersistentStore::access_start() {
 
   EEPROM.begin(); // Avoid STM32 EEPROM.h warning (do nothing)
 
-  #if ENABLED(FLASH_EEPROM_LEVELING)
+  #if ENABLED(FLASH_EEPROM_JOURNAL)
+
+    if (!journal_address || eeprom_data_written) {
+      if (eeprom_data_written) DEBUG_ECHOLNPGM("Dangling EEPROM write_data");
+      journal_replay();
+      eeprom_data_written = false;
+    }
+
+  #elif ENABLED(FLASH_EEPROM_LEVELING)
 
     if (current_slot == -1 || eeprom_data_written) {
       // This must be the first time since power on that we have accessed the storage, or someone
@@ -157,7 +300,35 @@ bool PersistentStore::access_finish() {
       __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGSERR);
     #endif
 
-    #if ENABLED(FLASH_EEPROM_LEVELING)
+    #if ENABLED(FLASH_EEPROM_JOURNAL)
+
+      HAL_FLASH_Unlock();
+      __HAL_FLASH_CLEAR_FLAG(FLASH_FLAGS_TO_CLEAR);
+
+      // Append a record for each run of changed blocks
+      bool success = true;
+      for (uint16_t block = 0; block < JOURNAL_BLOCKS;) {
+        if (!TEST(journal_dirty[block >> 3], block & 7)) { block++; continue; }
+        uint16_t end = block + 1;
+        while (end < JOURNAL_BLOCKS && TEST(journal_dirty[end >> 3], end & 7)) end++;
+        if (!journal_append(block * JOURNAL_BLOCK_SIZE, (end - block) * JOURNAL_BLOCK_SIZE)) {
+          success = journal_compact(); // The new image includes all remaining changes
+          break;
+        }
+        block = end;
+      }
+
+      HAL_FLASH_Lock();
+
+      if (success) {
+        ZERO(journal_dirty);
+        eeprom_data_written = false;
+        DEBUG_ECHOLNPGM("EEPROM journal at ", journal_address - (FLASH_ADDRESS_START), " of ", FLASH_UNIT_SIZE, " bytes.");
+      }
+
+      return success;
+
+    #elif ENABLED(FLASH_EEPROM_LEVELING)
 
       HAL_StatusTypeDef status = HAL_ERROR;
       bool flash_unlocked = false;
@@ -165,14 +336,6 @@ bool PersistentStore::access_finish() {
       if (--current_slot < 0) {
         // all slots have been used, erase everything and start again
 
-        FLASH_EraseInitTypeDef EraseInitStruct;
-        uint32_t SectorError = 0;
-
-        EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
-        EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
-        EraseInitStruct.Sector = FLASH_SECTOR;
-        EraseInitStruct.NbSectors = 1;
-
         current_slot = EEPROM_SLOTS - 1;
 
         if (!flash_unlocked) {
@@ -181,15 +344,7 @@ bool PersistentStore::access_finish() {
           flash_unlocked = true;
         }
 
-        TERN_(HAS_PAUSE_SERVO_OUTPUT, PAUSE_SERVO_OUTPUT());
-        hal.isr_off();
-        status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
-        hal.isr_on();
-        TERN_(HAS_PAUSE_SERVO_OUTPUT, RESUME_SERVO_OUTPUT());
-        if (status != HAL_OK) {
-          DEBUG_ECHOLNPGM("HAL_FLASHEx_Erase=", status);
-          DEBUG_ECHOLNPGM("GetError=", HAL_FLASH_GetError());
-          DEBUG_ECHOLNPGM("SectorError=", SectorError);
+        if (!erase_flash_sector()) {
           if (flash_unlocked) {
             HAL_FLASH_Lock();
             flash_unlocked = false;
@@ -273,6 +428,10 @@ bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, ui
       if (v != ram_eeprom[p]) {
         ram_eeprom[p] = v;
         eeprom_data_written = true;
+        #if ENABLED(FLASH_EEPROM_JOURNAL)
+          const uint16_t block = p / (JOURNAL_BLOCK_SIZE);
+          SBI(journal_dirty[block >> 3], block & 7);
+        #endif
       }
     #else
       if (v != eeprom_buffered_read_byte(p)) {
@@ -0,0 +1,216 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(NEOPIXEL_DMA)
+
+#include "neopixel_dma.h"
+#include "../../feature/leds/leds.h" // for HAS_WHITE_LED
+
+#define NEO_DMA_BYTES ((NEOPIXEL_PIXELS) * TERN(HAS_WHITE_LED, 4, 3))
+#define NEO_DMA_LATCH 240 // Low periods after the data, 300µs at 800kHz
+
+// One compare value per bit. The compare register is preloaded, so each value takes effect
+// one period after it's written. The leading zero covers that, the trailing zeros latch the strip.
+// That's 2 bytes of RAM per bit, e.g., 7.4K for 144 RGB pixels.
+static uint16_t neo_dma_buffer[1 + NEO_DMA_BYTES * 8 + NEO_DMA_LATCH]; // = { 0 }
+
+// The DMA transfer count register is 16-bit
+static_assert(COUNT(neo_dma_buffer) <= 0xFFFF, "NEOPIXEL_DMA supports up to " STRINGIFY(TERN(HAS_WHITE_LED, 2040, 2720)) " NEOPIXEL_PIXELS.");
+
+DMA_HandleTypeDef NeoPixelDMA::dma;
+uint32_t NeoPixelDMA::ccr_addr;
+uint16_t NeoPixelDMA::bit0, NeoPixelDMA::bit1;
+bool NeoPixelDMA::ready; // = false
+
+#ifdef STM32F1xx
+  typedef DMA_Channel_TypeDef DMA_Stream_t;
+#else
+  typedef DMA_Stream_TypeDef DMA_Stream_t;
+#endif
+
+#if ENABLED(SERIAL_DMA)
+  static constexpr bool serial_port_used(const int n) {
+    return n == SERIAL_PORT
+      #ifdef SERIAL_PORT_2
+        || n == SERIAL_PORT_2
+      #endif
+      #ifdef SERIAL_PORT_3
+        || n == SERIAL_PORT_3
+      #endif
+    ;
+  }
+#endif
+
+// The DMA streams (channels) of other drivers that may start later. Keep in sync with
+// tft_spi.cpp, tft_fsmc.cpp and HardwareSerial.cpp.
+static bool dma_in_use(const DMA_Stream_t * const stream) {
+  #if HAS_SPI_TFT
+    const SPI_TypeDef * const spi = (SPI_TypeDef *)pinmap_peripheral(digitalPinToPinName(TFT_SCK_PIN), PinMap_SPI_SCLK);
+    #ifdef STM32F1xx
+      if (spi == SPI1 && stream == DMA1_Channel3) return true;
+      if (spi == SPI2 && stream == DMA1_Channel5) return true;
+      #ifdef SPI3_BASE
+        if (spi == SPI3 && stream == DMA2_Channel2) return true;
+      #endif
+    #else
+      if (spi == SPI1 && stream == DMA2_Stream3) return true;
+      if (spi == SPI2 && stream == DMA1_Stream4) return true;
+      #ifdef SPI3_BASE
+        if (spi == SPI3 && stream == DMA1_Stream5) return true;
+      #endif
+    #endif
+  #endif
+
+  #if HAS_FSMC_TFT
+    #ifdef STM32F1xx
+      if (stream == DMA2_Channel1) return true;
+    #else
+      if (stream == DMA2_Stream0) return true;
+    #endif
+  #endif
+
+  #if ENABLED(SERIAL_DMA)
+    #ifdef STM32F1xx
+      if (serial_port_used(1) && stream == DMA1_Channel5) return true;
+      if (serial_port_used(2) && stream == DMA1_Channel6) return true;
+      if (serial_port_used(3) && stream == DMA1_Channel3) return true;
+      #ifdef DMA2_BASE
+        if (serial_port_used(4) && stream == DMA2_Channel3) return true;
+      #endif
+    #else
+      if (serial_port_used(1) && stream == DMA2_Stream2) return true;
+      if (serial_port_used(2) && stream == DMA1_Stream5) return true;
+      if (serial_port_used(3) && stream == DMA1_Stream1) return true;
+      if (serial_port_used(4) && stream == DMA1_Stream2) return true;
+      if (serial_port_used(5) && stream == DMA1_Stream0) return true;
+      if (serial_port_used(6) && stream == DMA2_Stream1) return true;
+    #endif
+  #endif
+
+  UNUSED(stream);
+  return false;
+}
+
+bool NeoPixelDMA::init(const pin_t pin) {
+  const PinName pin_name = digitalPinToPinName(pin);
+  TIM_TypeDef * const Instance = (TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM);
+  if (Instance == NP) return false;
+
+  // The DMA writes 16-bit compare values
+  #ifdef IS_TIM_32B_COUNTER_INSTANCE
+    if (IS_TIM_32B_COUNTER_INSTANCE(Instance)) return false;
+  #endif
+
+  // Don't take a timer that's in use, or will be once the steppers, heaters, etc. start
+  const timer_index_t index = get_timer_index(Instance);
+  if (index == TIMER_INDEX(STEP_TIMER) || index == TIMER_INDEX(TEMP_TIMER)) return false;
+  #if ENABLED(SPEAKER)
+    if (Instance == TIMER_TONE) return false;
+  #endif
+  #if HAS_SERVOS
+    if (Instance == TIMER_SERVO) return false;
+  #endif
+  if (HardwareTimer_Handle[index] != nullptr) return false;
+
+  // The DMA stream (channel) serving the timer's update event
+  dma.Instance = nullptr;
+  #ifdef STM32F1xx
+    if (Instance == TIM1) { __HAL_RCC_DMA1_CLK_ENABLE(); dma.Instance = DMA1_Channel5; }
+    if (Instance == TIM2) { __HAL_RCC_DMA1_CLK_ENABLE(); dma.Instance = DMA1_Channel2; }
+    if (Instance == TIM3) { __HAL_RCC_DMA1_CLK_ENABLE(); dma.Instance = DMA1_Channel3; }
+    #ifdef TIM4_BASE
+      if (Instance == TIM4) { __HAL_RCC_DMA1_CLK_ENABLE(); dma.Instance = DMA1_Channel7; }
+    #endif
+    #if defined(TIM5_BASE) && defined(DMA2_BASE)
+      if (Instance == TIM5) { __HAL_RCC_DMA2_CLK_ENABLE(); dma.Instance = DMA2_Channel2; }
+    #endif
+    #if defined(TIM8_BASE) && defined(DMA2_BASE)
+      if (Instance == TIM8) { __HAL_RCC_DMA2_CLK_ENABLE(); dma.Instance = DMA2_Channel1; }
+    #endif
+  #else // STM32F4xx
+    if (Instance == TIM1) { __HAL_RCC_DMA2_CLK_ENABLE(); dma.Instance = DMA2_Stream5; dma.Init.Channel = DMA_CHANNEL_6; }
+    if (Instance == TIM3) { __HAL_RCC_DMA1_CLK_ENABLE(); dma.Instance = DMA1_Stream2; dma.Init.Channel = DMA_CHANNEL_5; }
+    #ifdef TIM4_BASE
+      if (Instance == TIM4) { __HAL_RCC_DMA1_CLK_ENABLE(); dma.Instance = DMA1_Stream6; dma.Init.Channel = DMA_CHANNEL_2; }
+    #endif
+    #ifdef TIM8_BASE
+      if (Instance == TIM8) { __HAL_RCC_DMA2_CLK_ENABLE(); dma.Instance = DMA2_Stream1; dma.Init.Channel = DMA_CHANNEL_7; }
+    #endif
+  #endif
+  if (dma.Instance == nullptr || dma_in_use(dma.Instance)) return false;
+
+  dma.Init.Direction = DMA_MEMORY_TO_PERIPH;
+  dma.Init.PeriphInc = DMA_PINC_DISABLE;
+  dma.Init.MemInc = DMA_MINC_ENABLE;
+  dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  dma.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+  dma.Init.Mode = DMA_NORMAL;
+  dma.Init.Priority = DMA_PRIORITY_HIGH; // Each value must arrive within one 1.25µs period
+  #ifdef STM32F4xx
+    dma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  #endif
+  if (HAL_DMA_Init(&dma) != HAL_OK) return false;
+
+  // PWM at 800kHz with 0.4µs (0) and 0.8µs (1) high times
+  HardwareTimer * const HT = new HardwareTimer(Instance);
+  const uint32_t channel = STM_PIN_CHANNEL(pinmap_function(pin_name, PinMap_PWM));
+  HT->setMode(channel, TIMER_OUTPUT_COMPARE_PWM1, pin);
+  HT->setOverflow(800000, HERTZ_FORMAT);
+  const uint32_t period = HT->getOverflow(TICK_FORMAT);
+  bit0 = period * 8 / 25;
+  bit1 = period * 16 / 25;
+  HT->setCaptureCompare(channel, 0, TICK_COMPARE_FORMAT);
+
+  TIM_HandleTypeDef * const htim = HT->getHandle();
+  __HAL_TIM_ENABLE_OCxPRELOAD(htim, (channel - 1) << 2);  // TIM_CHANNEL_1..4
+  __HAL_TIM_ENABLE_DMA(htim, TIM_DMA_UPDATE);
+  HT->resume();
+
+  ccr_addr = uint32_t(&Instance->CCR1 + (channel - 1));
+  ready = true;
+  return true;
+}
+
+bool NeoPixelDMA::show(const uint8_t * const pixels) {
+  if (!ready) return false;
+
+  // Let the previous frame finish. Interrupts stay enabled.
+  while (busy()) { /* nada */ }
+  HAL_DMA_Abort(&dma); // Reset the stream state and flags after the unmonitored transfer
+
+  uint16_t *out = &neo_dma_buffer[1];
+  for (uint16_t i = 0; i < NEO_DMA_BYTES; ++i)
+    for (uint8_t mask = 0x80; mask; mask >>= 1)
+      *out++ = (pixels[i] & mask) ? bit1 : bit0;
+
+  HAL_DMA_Start(&dma, uint32_t(neo_dma_buffer), ccr_addr, COUNT(neo_dma_buffer));
+  return true;
+}
+
+#endif // NEOPIXEL_DMA
+#endif // HAL_STM32
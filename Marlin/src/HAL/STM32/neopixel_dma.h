@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * NeoPixel output by timer PWM and DMA.
+ *
+ * Each bit of the strip is one period of the NEOPIXEL_PIN timer at 800kHz.
+ * The timer's update event requests DMA to load the next compare value, so
+ * the strip is sent without masking interrupts or using the CPU.
+ *
+ * By the bit timing, bit-banging masks interrupts for 30µs per RGB pixel
+ * (4.3ms for 144 pixels). Here the CPU only fills the buffer, and the DMA
+ * delays other bus masters by a few cycles per 1.25µs bit. (Not measured.)
+ */
+
+#ifdef STM32F1xx
+  #include "stm32f1xx_hal.h"
+#elif defined(STM32F4xx)
+  #include "stm32f4xx_hal.h"
+#else
+  #error "NEOPIXEL_DMA is currently only supported on STM32F1 and STM32F4 hardware."
+#endif
+
+class NeoPixelDMA {
+public:
+  // Take over the PWM timer of the given pin. False if the pin can't be used.
+  static bool init(const pin_t pin);
+
+  // Start sending NEOPIXEL_PIXELS pixels (in wire order) and return.
+  // False if init() failed, so the caller can fall back to bit-banging.
+  static bool show(const uint8_t * const pixels);
+
+  // The previous frame (with its latch time) is still being sent
+  static bool busy() { return ready && __HAL_DMA_GET_COUNTER(&dma) != 0; }
+
+private:
+  static DMA_HandleTypeDef dma;
+  static uint32_t ccr_addr;       // Compare register of the pin's timer channel
+  static uint16_t bit0, bit1;     // Compare values for 0 and 1 bits
+  static bool ready;
+};
@@ -0,0 +1,134 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PHOTO_STROBE)
+
+#include "strobe_timer.h"
+
+HardwareTimer *StrobeTimer::timer; // = nullptr
+StrobeTimer::edge_t StrobeTimer::edge;
+volatile StrobeTimer::Stage StrobeTimer::stage; // = STROBE_IDLE
+volatile uint32_t StrobeTimer::remaining_us, StrobeTimer::lit_us;
+
+// Don't take a timer that's in use, or will be once the steppers, heaters, etc. start
+static bool timer_free(TIM_TypeDef * const Instance) {
+  const timer_index_t index = get_timer_index(Instance);
+  if (index == TIMER_INDEX(STEP_TIMER) || index == TIMER_INDEX(TEMP_TIMER)) return false;
+  #if ENABLED(SPEAKER)
+    if (Instance == TIMER_TONE) return false;
+  #endif
+  #if HAS_SERVOS
+    if (Instance == TIMER_SERVO) return false;
+  #endif
+  #if HAS_TMC_SW_SERIAL
+    #ifdef TIMER_SERIAL
+      if (Instance == TIMER_SERIAL) return false;
+    #elif defined(TIM18_BASE)
+      // SoftwareSerial takes the first timer of stm32_timer_map (timers.cpp)
+    #elif defined(TIM7_BASE)
+      if (Instance == TIM7) return false;
+    #elif defined(TIM6_BASE)
+      if (Instance == TIM6) return false;
+    #endif
+  #endif
+  return HardwareTimer_Handle[index] == nullptr;
+}
+
+bool StrobeTimer::init(const edge_t edge_fn) {
+  // Basic timers have no outputs, so no PWM pin will try to share them
+  TIM_TypeDef *Instance = nullptr;
+  #ifdef PHOTO_STROBE_TIMER
+    #define _STROBE_TIMER_DEV(X) TIM##X
+    #define STROBE_TIMER_DEV(X) _STROBE_TIMER_DEV(X)
+    if (timer_free(STROBE_TIMER_DEV(PHOTO_STROBE_TIMER))) Instance = STROBE_TIMER_DEV(PHOTO_STROBE_TIMER);
+  #else
+    #ifdef TIM7_BASE
+      if (!Instance && timer_free(TIM7)) Instance = TIM7;
+    #endif
+    #ifdef TIM6_BASE
+      if (!Instance && timer_free(TIM6)) Instance = TIM6;
+    #endif
+  #endif
+  if (Instance == nullptr) return false;
+
+  edge = edge_fn;
+  timer = new HardwareTimer(Instance);
+  timer->setPrescaleFactor(timer->getTimerClkFreq() / 1000000UL); // 1µs ticks
+  timer->setPreloadEnable(false);                                 // New periods apply at once
+  timer->refresh();                                               // Load the prescaler...
+  __HAL_TIM_CLEAR_FLAG(timer->getHandle(), TIM_FLAG_UPDATE);      // ...without an interrupt for it
+  timer->attachInterrupt(isr);
+  return true;
+}
+
+// Count the next part of the stage. The counter is 16-bit, so a long stage takes several periods.
+void StrobeTimer::next_period() {
+  const uint32_t ticks = _MIN(remaining_us, 0xFFFFUL), period = _MAX(ticks, 2UL);
+  remaining_us -= ticks;
+  timer->setOverflow(period, TICK_FORMAT);
+  // If the interrupt came late the counter may already be past the new period.
+  // Roll over now rather than count to 0xFFFF. (See HAL_timer_set_compare.)
+  if (timer->getCount() >= period) timer->refresh();
+}
+
+void StrobeTimer::start(const uint32_t delay_us, const uint32_t width_us) {
+  timer->pause();
+  lit_us = width_us;
+  if (delay_us) {
+    stage = STROBE_DELAY;
+    remaining_us = delay_us;
+  }
+  else {
+    edge(true);
+    stage = STROBE_LIT;
+    remaining_us = width_us;
+  }
+  timer->setCount(0);
+  next_period();
+  __HAL_TIM_CLEAR_FLAG(timer->getHandle(), TIM_FLAG_UPDATE); // Don't end the new stage with an old update
+  timer->resume();
+}
+
+void StrobeTimer::isr() {
+  if (remaining_us) return next_period();
+
+  if (stage == STROBE_DELAY) {
+    edge(true);
+    stage = STROBE_LIT;
+    remaining_us = lit_us;
+    next_period();
+  }
+  else {
+    edge(false);
+    stage = STROBE_IDLE;
+    timer->pause();
+  }
+}
+
+#endif // PHOTO_STROBE
+#endif // HAL_STM32
@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * One-shot timer for PHOTO_STROBE.
+ *
+ * A free basic timer (TIM7 or TIM6, or PHOTO_STROBE_TIMER) counts microseconds.
+ * Its update interrupt ends each stage of the strobe, so the edges are only
+ * late by the interrupt latency instead of a Temperature ISR tick.
+ */
+
+class StrobeTimer {
+public:
+  typedef void (*edge_t)(const bool on);
+
+  // Take over a free timer. False if there's none, so the caller can fall back to the Temperature ISR.
+  static bool init(const edge_t edge_fn);
+
+  // The timer was taken by init()
+  static bool ready() { return timer != nullptr; }
+
+  // Call edge(true) 'delay_us' from now and edge(false) 'width_us' after that
+  static void start(const uint32_t delay_us, const uint32_t width_us);
+
+  // The strobe is still pending or lit
+  static bool busy() { return stage != STROBE_IDLE; }
+
+private:
+  enum Stage : uint8_t { STROBE_IDLE, STROBE_DELAY, STROBE_LIT };
+
+  static HardwareTimer *timer;
+  static edge_t edge;
+  static volatile Stage stage;
+  static volatile uint32_t remaining_us, lit_us;
+
+  static void next_period();
+  static void isr();
+};
@@ -35,6 +35,17 @@ SRAM_HandleTypeDef TFT_FSMC::SRAMx;
 DMA_HandleTypeDef TFT_FSMC::DMAtx;
 LCD_CONTROLLER_TypeDef *TFT_FSMC::LCD;
 
+#if ENABLED(TFT_QUEUE_DMA_CHAINING)
+  void (*TFT_FSMC::dmaCallback)() = nullptr;
+  #ifdef STM32F1xx
+    #define TFT_DMA_IRQn DMA2_Channel1_IRQn
+    extern "C" void DMA2_Channel1_IRQHandler(void) { TFT_FSMC::DMA_IRQHandler(); }
+  #else
+    #define TFT_DMA_IRQn DMA2_Stream0_IRQn
+    extern "C" void DMA2_Stream0_IRQHandler(void) { TFT_FSMC::DMA_IRQHandler(); }
+  #endif
+#endif
+
 void TFT_FSMC::init() {
   uint32_t controllerAddress;
   FMC_OR_FSMC(NORSRAM_TimingTypeDef) timing, extTiming;
@@ -131,6 +142,11 @@ void TFT_FSMC::init() {
   DMAtx.Init.Mode                 = DMA_NORMAL;
   DMAtx.Init.Priority             = DMA_PRIORITY_HIGH;
 
+  #if ENABLED(TFT_QUEUE_DMA_CHAINING)
+    HAL_NVIC_SetPriority(TFT_DMA_IRQn, 15, 0); // Lowest priority. Never delay stepper or temperature interrupts.
+    HAL_NVIC_EnableIRQ(TFT_DMA_IRQn);
+  #endif
+
   LCD = (LCD_CONTROLLER_TypeDef *)controllerAddress;
 }
 
@@ -181,10 +197,26 @@ void TFT_FSMC::abort() {
 void TFT_FSMC::transmitDMA(uint32_t memoryIncrease, uint16_t *data, uint16_t count) {
   DMAtx.Init.PeriphInc = memoryIncrease;
   HAL_DMA_Init(&DMAtx);
-  HAL_DMA_Start(&DMAtx, (uint32_t)data, (uint32_t)&(LCD->RAM), count);
+  #if ENABLED(TFT_QUEUE_DMA_CHAINING)
+    DMAtx.XferCpltCallback = DMAtx.XferErrorCallback = dmaComplete; // HAL_DMA_DeInit clears these
+    HAL_DMA_Start_IT(&DMAtx, (uint32_t)data, (uint32_t)&(LCD->RAM), count);
+  #else
+    HAL_DMA_Start(&DMAtx, (uint32_t)data, (uint32_t)&(LCD->RAM), count);
+  #endif
   TERN_(TFT_SHARED_IO, while (isBusy()));
 }
 
+#if ENABLED(TFT_QUEUE_DMA_CHAINING)
+
+  void TFT_FSMC::dmaComplete(DMA_HandleTypeDef *hdma) {
+    // The IRQ handler has already cleared the TC/TE flags, so release
+    // the DMA here for isBusy() to see the controller as idle.
+    abort();
+    if (dmaCallback) dmaCallback();
+  }
+
+#endif
+
 void TFT_FSMC::transmit(uint32_t memoryIncrease, uint16_t *data, uint16_t count) {
   DMAtx.Init.PeriphInc = memoryIncrease;
   HAL_DMA_Init(&DMAtx);
@@ -64,6 +64,11 @@ class TFT_FSMC {
 
     static LCD_CONTROLLER_TypeDef *LCD;
 
+    #if ENABLED(TFT_QUEUE_DMA_CHAINING)
+      static void (*dmaCallback)();
+      static void dmaComplete(DMA_HandleTypeDef *hdma);
+    #endif
+
     static uint32_t readID(tft_data_t inReg);
     static void transmit(tft_data_t data) { LCD->RAM = data; __DSB(); }
     static void transmit(uint32_t memoryIncrease, uint16_t *data, uint16_t count);
@@ -84,6 +89,12 @@ class TFT_FSMC {
     static void writeSequence_DMA(uint16_t *data, uint16_t count) { transmitDMA(DMA_PINC_ENABLE, data, count); }
     static void writeMultiple_DMA(uint16_t color, uint16_t count) { static uint16_t data; data = color; transmitDMA(DMA_PINC_DISABLE, &data, count); }
 
+    #if ENABLED(TFT_QUEUE_DMA_CHAINING)
+      // Called from the DMA interrupt once a non-blocking transfer is complete
+      static void setDMACallback(void (*callback)()) { dmaCallback = callback; }
+      inline static void DMA_IRQHandler() { HAL_DMA_IRQHandler(&TFT_FSMC::DMAtx); }
+    #endif
+
     static void writeSequence(uint16_t *data, uint16_t count) { transmit(DMA_PINC_ENABLE, data, count); }
     static void writeMultiple(uint16_t color, uint32_t count) {
       while (count > 0) {
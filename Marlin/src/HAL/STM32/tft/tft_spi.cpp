@@ -38,6 +38,12 @@
 SPI_HandleTypeDef TFT_SPI::SPIx;
 DMA_HandleTypeDef TFT_SPI::DMAtx;
 
+#if ENABLED(TFT_QUEUE_DMA_CHAINING)
+  IRQn_Type TFT_SPI::dmaIRQ;
+  bool TFT_SPI::dmaChained; // = false
+  void (*TFT_SPI::dmaCallback)() = nullptr;
+#endif
+
 void TFT_SPI::init() {
   SPI_TypeDef *spiInstance;
 
@@ -94,15 +100,18 @@ void TFT_SPI::init() {
       #ifdef STM32F1xx
         __HAL_RCC_DMA1_CLK_ENABLE();
         DMAtx.Instance = DMA1_Channel3;
+        TERN_(TFT_QUEUE_DMA_CHAINING, dmaIRQ = DMA1_Channel3_IRQn);
         SPIx.Init.BaudRatePrescaler  = SPI_BAUDRATEPRESCALER_4; // SPI1 clock on F1 and F4 is two times faster than SPI2 and SPI3 clock
       #elif defined(STM32F4xx)
         __HAL_RCC_DMA2_CLK_ENABLE();
         DMAtx.Instance = DMA2_Stream3;
+        TERN_(TFT_QUEUE_DMA_CHAINING, dmaIRQ = DMA2_Stream3_IRQn);
         DMAtx.Init.Channel = DMA_CHANNEL_3;
         SPIx.Init.BaudRatePrescaler  = SPI_BAUDRATEPRESCALER_4; // SPI1 clock on F1 and F4 is two times faster than SPI2 and SPI3 clock
       #elif defined(STM32H7xx)
         __HAL_RCC_DMA1_CLK_ENABLE();
         DMAtx.Instance = DMA1_Stream4;
+        TERN_(TFT_QUEUE_DMA_CHAINING, dmaIRQ = DMA1_Stream4_IRQn);
         DMAtx.Init.Request = DMA_REQUEST_SPI1_TX;
       #endif
     }
@@ -113,13 +122,16 @@ void TFT_SPI::init() {
       #ifdef STM32F1xx
         __HAL_RCC_DMA1_CLK_ENABLE();
         DMAtx.Instance = DMA1_Channel5;
+        TERN_(TFT_QUEUE_DMA_CHAINING, dmaIRQ = DMA1_Channel5_IRQn);
       #elif defined(STM32F4xx)
         __HAL_RCC_DMA1_CLK_ENABLE();
         DMAtx.Instance = DMA1_Stream4;
+        TERN_(TFT_QUEUE_DMA_CHAINING, dmaIRQ = DMA1_Stream4_IRQn);
         DMAtx.Init.Channel = DMA_CHANNEL_0;
       #elif defined(STM32H7xx)
         __HAL_RCC_DMA1_CLK_ENABLE();
         DMAtx.Instance = DMA1_Stream4;
+        TERN_(TFT_QUEUE_DMA_CHAINING, dmaIRQ = DMA1_Stream4_IRQn);
         DMAtx.Init.Request = DMA_REQUEST_SPI2_TX;
       #endif
     }
@@ -130,13 +142,16 @@ void TFT_SPI::init() {
       #ifdef STM32F1xx
         __HAL_RCC_DMA2_CLK_ENABLE();
         DMAtx.Instance = DMA2_Channel2;
+        TERN_(TFT_QUEUE_DMA_CHAINING, dmaIRQ = DMA2_Channel2_IRQn);
       #elif defined(STM32F4xx)
         __HAL_RCC_DMA1_CLK_ENABLE();
         DMAtx.Instance = DMA1_Stream5;
+        TERN_(TFT_QUEUE_DMA_CHAINING, dmaIRQ = DMA1_Stream5_IRQn);
         DMAtx.Init.Channel = DMA_CHANNEL_0;
       #elif defined(STM32H7xx)
         __HAL_RCC_DMA1_CLK_ENABLE();
         DMAtx.Instance = DMA1_Stream4;
+        TERN_(TFT_QUEUE_DMA_CHAINING, dmaIRQ = DMA1_Stream4_IRQn);
         DMAtx.Init.Request = DMA_REQUEST_SPI3_TX;
       #endif
     }
@@ -151,6 +166,18 @@ void TFT_SPI::init() {
   #if ANY(STM32F4xx, STM32H7xx)
     DMAtx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
   #endif
+
+  #if ENABLED(TFT_QUEUE_DMA_CHAINING)
+    dmaChained = true;
+    #if ALL(STM32F4xx, SDIO_SUPPORT)
+      // SDIO owns the DMA2 Stream 3 interrupt (SPI1), so TFT_Queue polls these transfers instead
+      if (DMAtx.Instance == DMA2_Stream3) dmaChained = false;
+    #endif
+    if (dmaChained) {
+      HAL_NVIC_SetPriority(dmaIRQ, 15, 0); // Lowest priority. Never delay stepper or temperature interrupts.
+      HAL_NVIC_EnableIRQ(dmaIRQ);
+    }
+  #endif
 }
 
 void TFT_SPI::dataTransferBegin(uint16_t dataSize) {
@@ -314,16 +341,24 @@ void TFT_SPI::transmit(uint16_t data) {
   if (SPIx.Init.Direction == SPI_DIRECTION_2LINES) __HAL_SPI_CLEAR_OVRFLAG(&SPIx);  // Clear overrun flag in 2 Lines communication mode because received data is not read
 }
 
-void TFT_SPI::transmitDMA(uint32_t memoryIncrease, uint16_t *data, uint16_t count) {
+void TFT_SPI::transmitDMA(uint32_t memoryIncrease, uint16_t *data, uint16_t count, const bool notify/*=false*/) {
   DMAtx.Init.MemInc = memoryIncrease;
   HAL_DMA_Init(&DMAtx);
 
+  #if ENABLED(TFT_QUEUE_DMA_CHAINING)
+    // Blocking transfers poll for completion, so only non-blocking ones raise an interrupt
+    #define DMA_START(S, D, N) do{ if (notify && dmaChained) { DMAtx.XferCpltCallback = DMAtx.XferErrorCallback = dmaComplete; HAL_DMA_Start_IT(&DMAtx, S, D, N); } else HAL_DMA_Start(&DMAtx, S, D, N); }while(0)
+  #else
+    UNUSED(notify);
+    #define DMA_START(S, D, N) HAL_DMA_Start(&DMAtx, S, D, N)
+  #endif
+
   if (SPIx.Init.Direction == SPI_DIRECTION_1LINE) SPI_1LINE_TX(&SPIx);
 
   dataTransferBegin();
 
   #ifdef STM32H7xx
-    HAL_DMA_Start(&DMAtx, (uint32_t)data, (uint32_t)&(SPIx.Instance->TXDR), count);
+    DMA_START((uint32_t)data, (uint32_t)&(SPIx.Instance->TXDR), count);
 
     CLEAR_BIT(SPIx.Instance->CFG1, SPI_CFG1_TXDMAEN);
     MODIFY_REG(SPIx.Instance->CR2, SPI_CR2_TSIZE, count);
@@ -331,12 +366,14 @@ void TFT_SPI::transmitDMA(uint32_t memoryIncrease, uint16_t *data, uint16_t coun
     __HAL_SPI_ENABLE(&SPIx);
     SET_BIT(SPIx.Instance->CR1, SPI_CR1_CSTART);
   #else
-    HAL_DMA_Start(&DMAtx, (uint32_t)data, (uint32_t)&(SPIx.Instance->DR), count);
+    DMA_START((uint32_t)data, (uint32_t)&(SPIx.Instance->DR), count);
 
     __HAL_SPI_ENABLE(&SPIx);
     SET_BIT(SPIx.Instance->CR2, SPI_CR2_TXDMAEN);   // Enable Tx DMA Request
   #endif
 
+  #undef DMA_START
+
   TERN_(TFT_SHARED_IO, while (isBusy()));
 }
 
@@ -374,5 +411,48 @@ void TFT_SPI::transmit(uint32_t memoryIncrease, uint16_t *data, uint16_t count)
   extern "C" void DMA2_Stream3_IRQHandler(void) { TFT_SPI::DMA_IRQHandler(); }
 #endif
 
+#if ENABLED(TFT_QUEUE_DMA_CHAINING)
+
+  void TFT_SPI::dmaComplete(DMA_HandleTypeDef *hdma) {
+    // DMA is done once the last word is in the SPI, so let it drain before releasing CS
+    if (hdma->ErrorCode == HAL_DMA_ERROR_NONE) {
+      #ifdef STM32H7xx
+        while (!__HAL_SPI_GET_FLAG(&SPIx, SPI_SR_EOT)) { /* nada */ }
+      #else
+        while (!__HAL_SPI_GET_FLAG(&SPIx, SPI_FLAG_TXE)) { /* nada */ }
+        while (__HAL_SPI_GET_FLAG(&SPIx, SPI_FLAG_BSY)) { /* nada */ }
+      #endif
+    }
+    abort();
+    if (dmaCallback) dmaCallback();
+  }
+
+  // The DMA channel depends on which SPI the TFT is wired to
+  #ifdef STM32F1xx
+    #ifdef SPI1_BASE
+      extern "C" void DMA1_Channel3_IRQHandler(void) { TFT_SPI::DMA_IRQHandler(); }
+    #endif
+    #ifdef SPI2_BASE
+      extern "C" void DMA1_Channel5_IRQHandler(void) { TFT_SPI::DMA_IRQHandler(); }
+    #endif
+    #ifdef SPI3_BASE
+      extern "C" void DMA2_Channel2_IRQHandler(void) { TFT_SPI::DMA_IRQHandler(); }
+    #endif
+  #elif defined(STM32F4xx)
+    #if defined(SPI1_BASE) && DISABLED(SDIO_SUPPORT) // SDIO also uses DMA2 Stream 3
+      extern "C" void DMA2_Stream3_IRQHandler(void) { TFT_SPI::DMA_IRQHandler(); }
+    #endif
+    #ifdef SPI2_BASE
+      extern "C" void DMA1_Stream4_IRQHandler(void) { TFT_SPI::DMA_IRQHandler(); }
+    #endif
+    #ifdef SPI3_BASE
+      extern "C" void DMA1_Stream5_IRQHandler(void) { TFT_SPI::DMA_IRQHandler(); }
+    #endif
+  #elif defined(STM32H7xx)
+    extern "C" void DMA1_Stream4_IRQHandler(void) { TFT_SPI::DMA_IRQHandler(); }
+  #endif
+
+#endif
+
 #endif // HAS_SPI_TFT
 #endif // HAL_STM32
@@ -49,10 +49,17 @@ private:
   static SPI_HandleTypeDef SPIx;
   static DMA_HandleTypeDef DMAtx;
 
+  #if ENABLED(TFT_QUEUE_DMA_CHAINING)
+    static IRQn_Type dmaIRQ;
+    static bool dmaChained;       // False where another driver owns the DMA interrupt
+    static void (*dmaCallback)();
+    static void dmaComplete(DMA_HandleTypeDef *hdma);
+  #endif
+
   static uint32_t readID(const uint16_t inReg);
   static void transmit(uint16_t data);
   static void transmit(uint32_t memoryIncrease, uint16_t *data, uint16_t count);
-  static void transmitDMA(uint32_t memoryIncrease, uint16_t *data, uint16_t count);
+  static void transmitDMA(uint32_t memoryIncrease, uint16_t *data, uint16_t count, const bool notify=false);
   #if ENABLED(USE_SPI_DMA_TC)
     static void transmitDMA_IT(uint32_t memoryIncrease, uint16_t *data, uint16_t count);
   #endif
@@ -70,11 +77,17 @@ public:
   static void writeData(uint16_t data) { transmit(data); }
   static void writeReg(const uint16_t inReg) { WRITE(TFT_A0_PIN, LOW); transmit(inReg); WRITE(TFT_A0_PIN, HIGH); }
 
-  static void writeSequence_DMA(uint16_t *data, uint16_t count) { transmitDMA(DMA_MINC_ENABLE, data, count); }
-  static void writeMultiple_DMA(uint16_t color, uint16_t count) { static uint16_t data; data = color; transmitDMA(DMA_MINC_DISABLE, &data, count); }
+  static void writeSequence_DMA(uint16_t *data, uint16_t count) { transmitDMA(DMA_MINC_ENABLE, data, count, true); }
+  static void writeMultiple_DMA(uint16_t color, uint16_t count) { static uint16_t data; data = color; transmitDMA(DMA_MINC_DISABLE, &data, count, true); }
 
   #if ENABLED(USE_SPI_DMA_TC)
     static void writeSequenceIT(uint16_t *data, uint16_t count) { transmitDMA_IT(DMA_MINC_ENABLE, data, count); }
+  #endif
+  #if ENABLED(TFT_QUEUE_DMA_CHAINING)
+    // Called from the DMA interrupt once a non-blocking transfer has left the SPI bus
+    static void setDMACallback(void (*callback)()) { dmaCallback = callback; }
+  #endif
+  #if ANY(USE_SPI_DMA_TC, TFT_QUEUE_DMA_CHAINING)
     inline static void DMA_IRQHandler() { HAL_DMA_IRQHandler(&TFT_SPI::DMAtx); }
   #endif
 
@@ -67,31 +67,10 @@
   #endif
 #endif
 
-#if defined(STM32F0xx) || defined(STM32G0xx)
-  #define MCU_STEP_TIMER 16
-  #define MCU_TEMP_TIMER 17
-#elif defined(STM32F1xx)
-  #define MCU_STEP_TIMER  4
-  #define MCU_TEMP_TIMER  2
-#elif defined(STM32F401xC) || defined(STM32F401xE)
-  #define MCU_STEP_TIMER  9           // STM32F401 has no TIM6, TIM7, or TIM8
-  #define MCU_TEMP_TIMER 10
-#elif defined(STM32F4xx) || defined(STM32F7xx) || defined(STM32H7xx)
-  #define MCU_STEP_TIMER  6
-  #define MCU_TEMP_TIMER 14           // TIM7 is consumed by Software Serial if used.
-#endif
-
 #ifndef HAL_TIMER_RATE
   #define HAL_TIMER_RATE GetStepperTimerClkFreq()
 #endif
 
-#ifndef STEP_TIMER
-  #define STEP_TIMER MCU_STEP_TIMER
-#endif
-#ifndef TEMP_TIMER
-  #define TEMP_TIMER MCU_TEMP_TIMER
-#endif
-
 #define __TIMER_DEV(X) TIM##X
 #define _TIMER_DEV(X) __TIMER_DEV(X)
 #define STEP_TIMER_DEV _TIMER_DEV(STEP_TIMER)
@@ -296,7 +275,7 @@ TERN_(HAS_TMC_SW_SERIAL, static constexpr uintptr_t timer_serial[] = {uintptr_t(
 TERN_(SPEAKER,           static constexpr uintptr_t timer_tone[]   = {uintptr_t(TIMER_TONE)});
 TERN_(HAS_SERVOS,        static constexpr uintptr_t timer_servo[]  = {uintptr_t(TIMER_SERVO)});
 
-enum TimerPurpose { TP_SERIAL, TP_TONE, TP_SERVO, TP_STEP, TP_TEMP };
+enum TimerPurpose { TP_SERIAL, TP_TONE, TP_SERVO, TP_STEP, TP_TEMP, TP_STROBE };
 
 // List of timers, to enable checking for conflicts.
 // Includes the purpose of each timer to ease debugging when evaluating at build-time.
@@ -313,6 +292,9 @@ static constexpr struct { TimerPurpose p; int t; } timers_in_use[] = {
   #endif
   { TP_STEP, STEP_TIMER },
   { TP_TEMP, TEMP_TIMER },
+  #if ENABLED(PHOTO_STROBE) && defined(PHOTO_STROBE_TIMER)
+    { TP_STROBE, PHOTO_STROBE_TIMER },
+  #endif
 };
 
 static constexpr bool verify_no_timer_conflicts() {
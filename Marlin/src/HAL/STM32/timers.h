@@ -48,6 +48,28 @@
 #define TIMER_INDEX_(T) TIMER##T##_INDEX  // TIMER#_INDEX enums (timer_index_t) depend on TIM#_BASE defines.
 #define TIMER_INDEX(T) TIMER_INDEX_(T)    // Convert Timer ID to HardwareTimer_Handle index.
 
+// Hardware timer numbers (TIM#) for Stepper and Temperature. Override in the board pins file.
+#if defined(STM32F0xx) || defined(STM32G0xx)
+  #define MCU_STEP_TIMER 16
+  #define MCU_TEMP_TIMER 17
+#elif defined(STM32F1xx)
+  #define MCU_STEP_TIMER  4
+  #define MCU_TEMP_TIMER  2
+#elif defined(STM32F401xC) || defined(STM32F401xE)
+  #define MCU_STEP_TIMER  9           // STM32F401 has no TIM6, TIM7, or TIM8
+  #define MCU_TEMP_TIMER 10
+#elif defined(STM32F4xx) || defined(STM32F7xx) || defined(STM32H7xx)
+  #define MCU_STEP_TIMER  6
+  #define MCU_TEMP_TIMER 14           // TIM7 is consumed by Software Serial if used.
+#endif
+
+#ifndef STEP_TIMER
+  #define STEP_TIMER MCU_STEP_TIMER
+#endif
+#ifndef TEMP_TIMER
+  #define TEMP_TIMER MCU_TEMP_TIMER
+#endif
+
 #define TEMP_TIMER_FREQUENCY 1000   // Temperature::isr() is expected to be called at around 1kHz
 
 // TODO: get rid of manual rate/prescale/ticks/cycles taken for procedures in stepper.cpp
@@ -169,12 +169,12 @@ void MarlinHAL::adc_init() {
 
 #endif // !VOXELAB_N32
 
-void MarlinHAL::adc_start(const pin_t pin) {
+uint16_t MarlinHAL::adc_read(const pin_t pin) {
   #define __TCASE(N,I) case N: pin_index = I; break;
   #define _TCASE(C,N,I) TERN_(C, __TCASE(N, I))
   ADCIndex pin_index;
   switch (pin) {
-    default: return;
+    default: return 0;
     _TCASE(HAS_TEMP_ADC_0,        TEMP_0_PIN,                TEMP_0)
     _TCASE(HAS_TEMP_ADC_1,        TEMP_1_PIN,                TEMP_1)
     _TCASE(HAS_TEMP_ADC_2,        TEMP_2_PIN,                TEMP_2)
@@ -197,9 +197,11 @@ void MarlinHAL::adc_start(const pin_t pin) {
     _TCASE(POWER_MONITOR_CURRENT, POWER_MONITOR_CURRENT_PIN, POWERMON_CURRENT)
     _TCASE(POWER_MONITOR_VOLTAGE, POWER_MONITOR_VOLTAGE_PIN, POWERMON_VOLTAGE)
   }
-  adc_result = (adc_results[(int)pin_index] & 0xFFF) >> (12 - HAL_ADC_RESOLUTION); // shift out unused bits
+  return (adc_results[(int)pin_index] & 0xFFF) >> (12 - HAL_ADC_RESOLUTION); // shift out unused bits
 }
 
+void MarlinHAL::adc_start(const pin_t pin) { adc_result = adc_read(pin); }
+
 // ------------------------
 // Public functions
 // ------------------------
@@ -115,6 +115,7 @@ typedef int8_t pin_t;
 #endif
 
 #define HAL_ADC_VREF_MV   3300
+#define HAL_ADC_CONTINUOUS          // All ADC channels are converted continuously by DMA
 
 uint16_t analogRead(const pin_t pin); // need hal.adc_enable() first
 void analogWrite(const pin_t pin, int pwm_val8); // PWM only! mul by 257 in maple!?
@@ -218,6 +219,9 @@ public:
   // The current value of the ADC register
   static uint16_t adc_value() { return adc_result; }
 
+  // Latest DMA-converted value for the given pin. Safe to call from Temperature::isr.
+  static uint16_t adc_read(const pin_t pin);
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * Optionally invert the duty cycle [default = false]
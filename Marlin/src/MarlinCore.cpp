@@ -215,6 +215,10 @@
   #include "feature/caselight.h"
 #endif
 
+#if ENABLED(PHOTO_STROBE)
+  #include "feature/photo_strobe.h"
+#endif
+
 #if HAS_FANMUX
   #include "feature/fanmux.h"
 #endif
@@ -227,6 +231,10 @@
   #include "feature/fancheck.h"
 #endif
 
+#if ENABLED(BINARY_REPORTS)
+  #include "feature/binary_report.h"
+#endif
+
 #if ENABLED(USE_CONTROLLER_FAN)
   #include "feature/controllerfan.h"
 #endif
@@ -810,6 +818,7 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   #if ENABLED(POWER_LOSS_RECOVERY) && PIN_EXISTS(POWER_LOSS)
     if (card.isStillPrinting()) recovery.outage();
   #endif
+  TERN_(POWER_LOSS_ASYNC_WRITE, recovery.commit()); // Write one sector of pending power-loss data
 
   // Run StallGuard endstop checks
   #if ENABLED(SPI_ENDSTOPS)
@@ -844,7 +853,7 @@ void idle(const bool no_stepper_sleep/*=false*/) {
       const millis_t ms = millis();
       if (ELAPSED(ms, i2cpem_next_update_ms)) {
         I2CPEM.update();
-        i2cpem_next_update_ms = ms + I2CPE_MIN_UPD_TIME_MS;
+        i2cpem_next_update_ms = ms + I2CPE_UPDATE_INTERVAL_MS;
       }
     }
   }
@@ -858,6 +867,8 @@ void idle(const bool no_stepper_sleep/*=false*/) {
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
       TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
       TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
+      TERN_(BINARY_REPORTS, binary_report.tick());
+      TERN_(POSITION_TELEMETRY, position_telemetry.tick());
     }
   #endif
 
@@ -1413,6 +1424,10 @@ void setup() {
     OUT_WRITE(PHOTOGRAPH_PIN, LOW);
   #endif
 
+  #if ENABLED(PHOTO_STROBE)
+    photo_strobe.init();
+  #endif
+
   #if HAS_CUTTER
     SETUP_RUN(cutter.init());
   #endif
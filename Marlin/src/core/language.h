@@ -237,6 +237,8 @@
 #define STR_MPC_HEATING_PAST_200            "Heating to over 200C"
 #define STR_MPC_MEASURING_AMBIENT           "Measuring ambient heatloss at "
 #define STR_MPC_TEMPERATURE_ERROR           "Temperature error"
+#define STR_MPC_BED_AUTOTUNE_START          "MPC Autotune start for bed"
+#define STR_MPC_BED_HEATING_TO              "Heating bed to "
 
 #define STR_HEATER_BED                      "bed"
 #define STR_HEATER_CHAMBER                  "chamber"
@@ -31,6 +31,9 @@
 
 AxisBits Backlash::last_direction_bits;
 xyz_long_t Backlash::residual_error{0};
+#if ENABLED(BACKLASH_SMOOTHING_LINEAR)
+  xyz_float_t Backlash::smoothing_rate{0};
+#endif
 
 #ifdef BACKLASH_DISTANCE_MM
   #if ENABLED(BACKLASH_GCODE)
@@ -61,6 +64,9 @@ Backlash backlash;
  *
  * With a non-zero BACKLASH_SMOOTHING_MM value the backlash correction is
  * spread over multiple segments, smoothing out artifacts even more.
+ *
+ * BACKLASH_SMOOTHING_LINEAR works out the rate when the direction changes,
+ * so the correction is added evenly per mm and done within smoothing_mm.
  */
 
 void Backlash::add_correction_steps(const xyze_long_t &dist, const AxisBits dm, block_t * const block) {
@@ -87,7 +93,7 @@ void Backlash::add_correction_steps(const xyze_long_t &dist, const AxisBits dm,
 
   if (!correction && !residual_error) return;
 
-  #ifdef BACKLASH_SMOOTHING_MM
+  #if defined(BACKLASH_SMOOTHING_MM) && DISABLED(BACKLASH_SMOOTHING_LINEAR)
     // The segment proportion is a value greater than 0.0 indicating how much residual_error
     // is corrected for in this segment. The contribution is based on segment length and the
     // smoothing distance. Since the computation of this proportion involves a floating point
@@ -110,17 +116,26 @@ void Backlash::add_correction_steps(const xyze_long_t &dist, const AxisBits dm,
       const bool forward = dm[axis];
 
       // When an axis changes direction, add axis backlash to the residual error
-      if (changed_dir[axis])
+      if (changed_dir[axis]) {
         residual_error[axis] += (forward ? f_corr : -f_corr) * distance_mm[axis] * planner.settings.axis_steps_per_mm[axis];
+        TERN_(BACKLASH_SMOOTHING_LINEAR, smoothing_rate[axis] = 0);
+      }
 
       // Decide how much of the residual error to correct in this segment
       int32_t error_correction = residual_error[axis];
 
       #ifdef BACKLASH_SMOOTHING_MM
         if (error_correction && smoothing_mm != 0) {
-          // Take up a portion of the residual_error in this segment
-          if (segment_proportion == 0) segment_proportion = _MIN(1.0f, block->millimeters / smoothing_mm);
-          error_correction = CEIL(segment_proportion * error_correction);
+          #if ENABLED(BACKLASH_SMOOTHING_LINEAR)
+            // Spread the whole residual_error evenly over the smoothing distance
+            if (!smoothing_rate[axis]) smoothing_rate[axis] = ABS(error_correction) / smoothing_mm;
+            const int32_t segment_limit = CEIL(smoothing_rate[axis] * block->millimeters);
+            LIMIT(error_correction, -segment_limit, segment_limit);
+          #else
+            // Take up a portion of the residual_error in this segment
+            if (segment_proportion == 0) segment_proportion = _MIN(1.0f, block->millimeters / smoothing_mm);
+            error_correction = CEIL(segment_proportion * error_correction);
+          #endif
         }
       #endif
 
@@ -191,7 +206,13 @@ class Backlash::StepAdjuster {
     }
     ~StepAdjuster() {
       // after backlash compensation parameter changes, ensure applied step count does not change
-      LOOP_NUM_AXES(axis) residual_error[axis] += backlash.get_applied_steps((AxisEnum)axis) - applied_steps[axis];
+      LOOP_NUM_AXES(axis) {
+        residual_error[axis] += backlash.get_applied_steps((AxisEnum)axis) - applied_steps[axis];
+        #if ENABLED(BACKLASH_SMOOTHING_LINEAR)
+          // Spread the remaining error over the current smoothing distance
+          smoothing_rate[axis] = smoothing_mm ? ABS(residual_error[axis]) / smoothing_mm : 0;
+        #endif
+      }
     }
 };
 
@@ -31,6 +31,9 @@ public:
 private:
   static AxisBits last_direction_bits;
   static xyz_long_t residual_error;
+  #if ENABLED(BACKLASH_SMOOTHING_LINEAR)
+    static xyz_float_t smoothing_rate;  // Correction steps per mm of travel
+  #endif
 
   #if ENABLED(BACKLASH_GCODE)
     static uint8_t correction;
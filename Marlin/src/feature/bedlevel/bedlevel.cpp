@@ -135,7 +135,8 @@ void reset_bed_level() {
   /**
    * Print calibration results for plotting or manual frame adjustment.
    */
-  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values) {
+  template<typename T>
+  static void _print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const T *values) {
     #ifndef SCAD_MESH_OUTPUT
       for (uint8_t x = 0; x < sx; ++x) {
         SERIAL_ECHO_SP(precision + (x < 10 ? 3 : 2));
@@ -186,6 +187,15 @@ void reset_bed_level() {
     SERIAL_EOL();
   }
 
+  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values) {
+    _print_2d_array(sx, sy, precision, values);
+  }
+  #if ENABLED(QUANTIZED_MESH)
+    void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const mesh_z_t *values) {
+      _print_2d_array(sx, sy, precision, values);
+    }
+  #endif
+
 #endif // AUTO_BED_LEVELING_BILINEAR || MESH_BED_LEVELING
 
 #if ANY(MESH_BED_LEVELING, PROBE_MANUALLY)
@@ -59,7 +59,44 @@ class TemporaryBedLevelingState {
 
 #if HAS_MESH
 
-  typedef float bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+  /**
+   * Mesh Z as signed 16-bit micrometers, with INT16_MAX for NAN (an unprobed point).
+   * Used by QUANTIZED_MESH, OPTIMIZED_MESH_STORAGE, and BINARY_MESH. Values beyond
+   * ±32.766mm are clamped, so they aren't mistaken for unprobed points.
+   */
+  constexpr int16_t MESH_UM_NAN = INT16_MAX;
+  constexpr float MESH_UM_MAX_Z = 32.766f;
+
+  inline int16_t mesh_z_to_um(const_float_t z) {
+    return isnan(z) ? MESH_UM_NAN : int16_t(LROUND(constrain(z, -MESH_UM_MAX_Z, MESH_UM_MAX_Z) * 1000.0f));
+  }
+  inline float mesh_um_to_z(const int16_t um) { return um == MESH_UM_NAN ? NAN : um * 0.001f; }
+
+  #if ENABLED(QUANTIZED_MESH)
+
+    /**
+     * A mesh Z value kept in RAM as 16-bit micrometers, as above.
+     * Reads and writes convert to and from float so mesh code is unchanged.
+     */
+    struct mesh_z_t {
+      int16_t um;
+      mesh_z_t() = default;
+      mesh_z_t(const_float_t z) { *this = z; }
+      mesh_z_t& operator=(const_float_t z) { um = mesh_z_to_um(z); return *this; }
+      operator float() const { return mesh_um_to_z(um); }
+      mesh_z_t& operator+=(const_float_t v) { return *this = float(*this) + v; }
+      mesh_z_t& operator-=(const_float_t v) { return *this = float(*this) - v; }
+      mesh_z_t& operator*=(const_float_t v) { return *this = float(*this) * v; }
+    };
+    static_assert(sizeof(mesh_z_t) == sizeof(int16_t), "mesh_z_t must be 16 bits.");
+
+  #else
+
+    typedef float mesh_z_t;
+
+  #endif
+
+  typedef mesh_z_t bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
     #include "abl/bbl.h"
@@ -79,6 +116,9 @@ class TemporaryBedLevelingState {
      * Print calibration results for plotting or manual frame adjustment.
      */
     void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values);
+    #if ENABLED(QUANTIZED_MESH)
+      void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const mesh_z_t *values);
+    #endif
 
   #endif
 
@@ -41,6 +41,10 @@ struct mesh_index_pair;
 #define MESH_X_DIST (float((MESH_MAX_X) - (MESH_MIN_X)) / (GRID_MAX_CELLS_X))
 #define MESH_Y_DIST (float((MESH_MAX_Y) - (MESH_MIN_Y)) / (GRID_MAX_CELLS_Y))
 
+// Grid position lookup tables are only built for axes of up to 16 points
+#define UBL_MESH_X_TABLE ((GRID_MAX_POINTS_X) <= 16)
+#define UBL_MESH_Y_TABLE ((GRID_MAX_POINTS_Y) <= 16)
+
 #if ENABLED(OPTIMIZED_MESH_STORAGE)
   typedef int16_t mesh_store_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 #endif
@@ -116,8 +120,12 @@ public:
     static void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
     static void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
   #endif
-  static const float _mesh_index_to_xpos[GRID_MAX_POINTS_X],
-                     _mesh_index_to_ypos[GRID_MAX_POINTS_Y];
+  #if UBL_MESH_X_TABLE
+    static const float _mesh_index_to_xpos[GRID_MAX_POINTS_X];
+  #endif
+  #if UBL_MESH_Y_TABLE
+    static const float _mesh_index_to_ypos[GRID_MAX_POINTS_Y];
+  #endif
 
   #if HAS_MARLINUI_MENU
     static bool lcd_map_control;
@@ -288,10 +296,16 @@ public:
   static constexpr float get_z_offset() { return 0.0f; }
 
   static float get_mesh_x(const uint8_t i) {
-    return i < (GRID_MAX_POINTS_X) ? pgm_read_float(&_mesh_index_to_xpos[i]) : MESH_MIN_X + i * (MESH_X_DIST);
+    #if UBL_MESH_X_TABLE
+      if (i < (GRID_MAX_POINTS_X)) return pgm_read_float(&_mesh_index_to_xpos[i]);
+    #endif
+    return MESH_MIN_X + i * (MESH_X_DIST);
   }
   static float get_mesh_y(const uint8_t i) {
-    return i < (GRID_MAX_POINTS_Y) ? pgm_read_float(&_mesh_index_to_ypos[i]) : MESH_MIN_Y + i * (MESH_Y_DIST);
+    #if UBL_MESH_Y_TABLE
+      if (i < (GRID_MAX_POINTS_Y)) return pgm_read_float(&_mesh_index_to_ypos[i]);
+    #endif
+    return MESH_MIN_Y + i * (MESH_Y_DIST);
   }
 
   #if UBL_SEGMENTED
@@ -300,6 +314,29 @@ public:
     static void line_to_destination_cartesian(const_feedRate_t scaled_fr_mm_s, const uint8_t e);
   #endif
 
+  /**
+   * Step through the mesh lines crossed by an XY move in the order they are reached.
+   * The parametric distance between lines is constant on each axis, so it is found
+   * once per move (DDA-style) and each crossing costs only a few multiply-adds.
+   */
+  class mesh_line_walker {
+    public:
+      mesh_line_walker(const xy_pos_t &start, const xy_pos_t &end);
+
+      // Get the next crossing point, its fraction of the move (0 < t < 1), and the
+      // Z correction there (NAN replaced by 0). Return false when no crossings remain.
+      bool next(xy_pos_t &pos, float &t, float &z);
+
+    private:
+      xy_pos_t start, dist;
+      xy_float_t t_next, t_step;  // Move fraction at the next line, and between lines
+      xy_int_t  icell,            // Cell containing the current point. 16-bit for grids over 127 points.
+                line,             // Index of the next mesh line on each axis
+                iadd;             // Line index step for each axis (-1, 0, 1)
+      xy_uint8_t cnt;             // Lines remaining on each axis
+      float t_last;
+  };
+
   static bool mesh_is_valid() {
     GRID_LOOP(x, y) if (isnan(z_values[x][y])) return false;
     return true;
@@ -1692,45 +1692,67 @@ void unified_bed_leveling::smart_fill_mesh() {
     // being extrapolated so that nearby points will have greater influence on
     // the point being extrapolated.  Then extrapolate the mesh point from WLSF.
 
-    static_assert((GRID_MAX_POINTS_Y) <= 16, "GRID_MAX_POINTS_Y too big");
-    uint16_t bitmap[GRID_MAX_POINTS_X] = { 0 };
+    // Each pair of points is weighted by 1 + weight_scaled / distance. That kernel isn't
+    // separable, so an exact fill stays O(holes x probed points). The weight is computed
+    // on the fly, and each column of probed points is first reduced to five weighted sums
+    // so X only enters the fit once per column. Without weighting every hole gets the
+    // same plane, so the fit is only done once.
+
+    Flags<GRID_MAX_POINTS> probed;
+    probed.reset();
     struct linear_fit_data lsf_results;
+    bool fit_done = false;
 
     SERIAL_ECHOPGM("Extrapolating mesh...");
 
     const float weight_scaled = weight_factor * _MAX(MESH_X_DIST, MESH_Y_DIST);
 
-    GRID_LOOP(jx, jy) if (!isnan(z_values[jx][jy])) SBI(bitmap[jx], jy);
+    GRID_LOOP(jx, jy) if (!isnan(z_values[jx][jy])) probed.set(jx * (GRID_MAX_POINTS_Y) + jy);
 
     xy_pos_t ppos;
     for (uint8_t ix = 0; ix < GRID_MAX_POINTS_X; ++ix) {
       ppos.x = get_mesh_x(ix);
       for (uint8_t iy = 0; iy < GRID_MAX_POINTS_Y; ++iy) {
+        if (!isnan(z_values[ix][iy])) continue;
         ppos.y = get_mesh_y(iy);
-        if (isnan(z_values[ix][iy])) {
+        if (weight_scaled || !fit_done) {
           // undefined mesh point at (ppos.x,ppos.y), compute weighted LSF from original valid mesh points.
           incremental_LSF_reset(&lsf_results);
-          xy_pos_t rpos;
           for (uint8_t jx = 0; jx < GRID_MAX_POINTS_X; ++jx) {
-            rpos.x = get_mesh_x(jx);
+            const float rx = get_mesh_x(jx), dx2 = sq((int16_t(jx) - ix) * (MESH_X_DIST));
+            float sw = 0, swy = 0, swz = 0, swy2 = 0, swyz = 0, wmax = 0, wymax = 0;
             for (uint8_t jy = 0; jy < GRID_MAX_POINTS_Y; ++jy) {
-              if (TEST(bitmap[jx], jy)) {
-                rpos.y = get_mesh_y(jy);
-                const float rz = z_values[jx][jy],
-                             w = 1.0f + weight_scaled / (rpos - ppos).magnitude();
-                incremental_WLSF(&lsf_results, rpos, rz, w);
-              }
+              if (!probed.test(jx * (GRID_MAX_POINTS_Y) + jy)) continue;
+              const float ry = get_mesh_y(jy), rz = z_values[jx][jy],
+                          w = weight_scaled ? 1.0f + weight_scaled * RSQRT(dx2 + sq((int16_t(jy) - iy) * (MESH_Y_DIST))) : 1.0f,
+                          wy = w * ry;
+              sw += w; swy += wy; swz += w * rz; swy2 += wy * ry; swyz += wy * rz;
+              NOLESS(wmax, w); NOLESS(wymax, ABS(wy));
             }
+            if (!sw) continue;
+            // The same sums incremental_WLSF() makes, for the whole column at once
+            lsf_results.N     += sw;
+            lsf_results.xbar  += rx * sw;
+            lsf_results.ybar  += swy;
+            lsf_results.zbar  += swz;
+            lsf_results.x2bar += sq(rx) * sw;
+            lsf_results.y2bar += swy2;
+            lsf_results.xybar += rx * swy;
+            lsf_results.xzbar += rx * swz;
+            lsf_results.yzbar += swyz;
+            NOLESS(lsf_results.max_absx, ABS(rx) * wmax);
+            NOLESS(lsf_results.max_absy, wymax);
           }
           if (finish_incremental_LSF(&lsf_results)) {
             SERIAL_ECHOLNPGM(" Insufficient data");
             return;
           }
-          const float ez = -lsf_results.D - lsf_results.A * ppos.x - lsf_results.B * ppos.y;
-          z_values[ix][iy] = ez;
-          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, z_values[ix][iy]));
-          idle(); // housekeeping
+          fit_done = true;
         }
+        const float ez = -lsf_results.D - lsf_results.A * ppos.x - lsf_results.B * ppos.y;
+        z_values[ix][iy] = ez;
+        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ix, iy, z_values[ix][iy]));
+        idle(); // housekeeping
       }
     }
 
@@ -1858,7 +1880,7 @@ void unified_bed_leveling::smart_fill_mesh() {
 
     param.KLS_storage_slot = (int8_t)parser.value_int();
 
-    float tmp_z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+    bed_mesh_t tmp_z_values;
     settings.load_mesh(param.KLS_storage_slot, &tmp_z_values);
 
     SERIAL_ECHOLNPGM("Subtracting mesh in slot ", param.KLS_storage_slot, " from current mesh.");
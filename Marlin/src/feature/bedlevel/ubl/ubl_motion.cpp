@@ -39,6 +39,66 @@
 #define DEBUG_OUT ENABLED(DEBUG_UBL_MOTION)
 #include "../../../core/debug_out.h"
 
+unified_bed_leveling::mesh_line_walker::mesh_line_walker(const xy_pos_t &s, const xy_pos_t &e) : start(s), t_last(0) {
+  dist = e - s;
+  const xy_uint8_t istart = cell_indexes(s), iend = cell_indexes(e);
+  icell.set(istart.x, istart.y);
+  cnt = istart.diff(iend);
+
+  // Moving forward the first line is at the far edge of the start cell, moving back it's the near edge.
+  // Only one float divide per axis is needed to find the move fraction between lines.
+  iadd.x = iend.x > icell.x ? 1 : iend.x < icell.x ? -1 : 0;
+  if (iadd.x) {
+    line.x = icell.x + (iadd.x > 0);
+    const float inv_dx = 1.0f / dist.x;
+    t_next.x = (get_mesh_x(line.x) - s.x) * inv_dx;
+    t_step.x = (MESH_X_DIST) * ABS(inv_dx);
+  }
+  iadd.y = iend.y > icell.y ? 1 : iend.y < icell.y ? -1 : 0;
+  if (iadd.y) {
+    line.y = icell.y + (iadd.y > 0);
+    const float inv_dy = 1.0f / dist.y;
+    t_next.y = (get_mesh_y(line.y) - s.y) * inv_dy;
+    t_step.y = (MESH_Y_DIST) * ABS(inv_dy);
+  }
+}
+
+bool unified_bed_leveling::mesh_line_walker::next(xy_pos_t &pos, float &t, float &z) {
+  while (cnt.x || cnt.y) {
+    if (cnt.x && (!cnt.y || t_next.x <= t_next.y)) {
+      // Crossing a vertical (X) mesh line next
+      t = t_next.x;
+      pos.set(get_mesh_x(line.x), start.y + dist.y * t);
+      z = z_correction_for_y_on_vertical_mesh_line(pos.y, line.x, icell.y);
+      icell.x = line.x - (iadd.x < 0);
+      line.x += iadd.x;
+      t_next.x += t_step.x;
+      cnt.x--;
+    }
+    else {
+      // Crossing a horizontal (Y) mesh line next
+      t = t_next.y;
+      pos.set(start.x + dist.x * t, get_mesh_y(line.y));
+      z = z_correction_for_x_on_horizontal_mesh_line(pos.x, icell.x, line.y);
+      icell.y = line.y - (iadd.y < 0);
+      line.y += iadd.y;
+      t_next.y += t_step.y;
+      cnt.y--;
+    }
+
+    // Skip crossings at the start or end of the move and the second line at a mesh corner
+    if (t > t_last && t < 1.0f) {
+      t_last = t;
+      // Undefined parts of the Mesh in z_values[][] are NAN.
+      // Replace NAN corrections with 0.0 to prevent NAN propagation.
+      if (isnan(z)) z = 0.0f;
+      return true;
+    }
+    DEBUG_ECHOLNPGM("[ubl] skip segment");
+  }
+  return false;
+}
+
 #if !UBL_SEGMENTED
 
   // TODO: The first and last parts of a move might result in very short segment(s)
@@ -61,273 +121,56 @@
       const xyze_pos_t &start = current_position, &end = destination;
     #endif
 
-    const xy_uint8_t istart = cell_indexes(start), iend = cell_indexes(end);
-
-    // A move within the same cell needs no splitting
-    if (istart == iend) {
-
-      FINAL_MOVE:
-
-      // When UBL_Z_RAISE_WHEN_OFF_MESH is disabled Z correction is extrapolated from the edge of the mesh
-      #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
-        // For a move off the UBL mesh, use a constant Z raise
-        if (!cell_index_x_valid(end.x) || !cell_index_y_valid(end.y)) {
-
-          // Note: There is no Z Correction in this case. We are off the mesh and don't know what
-          // a reasonable correction would be, UBL_Z_RAISE_WHEN_OFF_MESH will be used instead of
-          // a calculated (Bi-Linear interpolation) correction.
-
-          end.z += UBL_Z_RAISE_WHEN_OFF_MESH;
-          planner.buffer_segment(end, scaled_fr_mm_s, extruder);
-          current_position = destination;
-          return;
-        }
-      #endif
-
-      // The distance is always MESH_X_DIST so multiply by the constant reciprocal.
-      const float xratio = (end.x - get_mesh_x(iend.x)) * RECIPROCAL(MESH_X_DIST),
-                  yratio = (end.y - get_mesh_y(iend.y)) * RECIPROCAL(MESH_Y_DIST),
-                  z1 = z_values[iend.x][iend.y    ] + xratio * (z_values[iend.x + 1][iend.y    ] - z_values[iend.x][iend.y    ]),
-                  z2 = z_values[iend.x][iend.y + 1] + xratio * (z_values[iend.x + 1][iend.y + 1] - z_values[iend.x][iend.y + 1]);
-
-      // X cell-fraction done. Interpolate the two Z offsets with the Y fraction for the final Z offset.
-      const float z0 = (z1 + (z2 - z1) * yratio) * planner.fade_scaling_factor_for_z(end.z);
-
-      // Undefined parts of the Mesh in z_values[][] are NAN.
-      // Replace NAN corrections with 0.0 to prevent NAN propagation.
-      if (!isnan(z0)) end.z += z0;
-      planner.buffer_segment(end, scaled_fr_mm_s, extruder);
-      current_position = destination;
-      return;
-    }
-
-    /**
-     * Past this point the move is known to cross one or more mesh lines. Check for the most common
-     * case - crossing only one X or Y line - after details are worked out to reduce computation.
-     */
-
-    const xy_float_t dist = end - start;
-    const xy_bool_t neg { dist.x < 0, dist.y < 0 };
-    const xy_uint8_t ineg { uint8_t(neg.x), uint8_t(neg.y) };
-    const xy_float_t sign { neg.x ? -1.0f : 1.0f, neg.y ? -1.0f : 1.0f };
-    const xy_int8_t iadd { int8_t(iend.x == istart.x ? 0 : sign.x), int8_t(iend.y == istart.y ? 0 : sign.y) };
-
     /**
-     * Compute the extruder scaling factor for each partial move, checking for
-     * zero-length moves that would result in an infinite scaling factor.
-     * A float divide is required for this, but then it just multiplies.
-     * Also select a scaling factor based on the larger of the X and Y
-     * components. The larger of the two is used to preserve precision.
+     * A move that crosses one or more mesh lines is split at each crossing, with the
+     * Z correction for that point on the line. Other axes are interpolated by the
+     * fraction of the move, so no float divide is needed per crossing.
      */
-
-    const xy_float_t ad = sign * dist;
-    const bool use_x_dist = ad.x > ad.y;
-
-    float on_axis_distance = use_x_dist ? dist.x : dist.y;
-
-    const float z_normalized_dist = (end.z - start.z) / on_axis_distance; // Allow divide by zero
-    #if HAS_EXTRUDERS
-      const float e_normalized_dist = (end.e - start.e) / on_axis_distance;
-      const bool inf_normalized_flag = isinf(e_normalized_dist);
-    #endif
-
-    xy_uint8_t icell = istart;
-
-    const float ratio = dist.y / dist.x,        // Allow divide by zero
-                c = start.y - ratio * start.x;
-
-    const bool inf_ratio_flag = isinf(ratio);
-
-    xyze_pos_t dest; // Stores XYZE for segmented moves
-
-    /**
-     * Handle vertical lines that stay within one column.
-     * These need not be perfectly vertical.
-     */
-    if (iadd.x == 0) {        // Vertical line?
-      icell.y += ineg.y;      // Line going down? Just go to the bottom.
-      while (icell.y != iend.y + ineg.y) {
-        icell.y += iadd.y;
-        const float next_mesh_line_y = get_mesh_y(icell.y);
-
-        /**
-         * Skip the calculations for an infinite slope.
-         * For others the next X is the same so this can continue.
-         * Calculate X at the next Y mesh line.
-         */
-        dest.x = inf_ratio_flag ? start.x : (next_mesh_line_y - c) / ratio;
-
-        float z0 = z_correction_for_x_on_horizontal_mesh_line(dest.x, icell.x, icell.y)
-                   * planner.fade_scaling_factor_for_z(end.z);
-
-        // Undefined parts of the Mesh in z_values[][] are NAN.
-        // Replace NAN corrections with 0.0 to prevent NAN propagation.
-        if (isnan(z0)) z0 = 0.0;
-
-        dest.y = get_mesh_y(icell.y);
-
-        /**
-         * Without this check, it's possible to generate a zero length move, as in the case where
-         * the line is heading down, starting exactly on a mesh line boundary. Since this is rare
-         * it might be fine to remove this check and let planner.buffer_segment() filter it out.
-         */
-        if (dest.y != start.y) {
-          if (!inf_normalized_flag) { // fall-through faster than branch
-            on_axis_distance = use_x_dist ? dest.x - start.x : dest.y - start.y;
-            TERN_(HAS_EXTRUDERS, dest.e = start.e + on_axis_distance * e_normalized_dist);
-            dest.z = start.z + on_axis_distance * z_normalized_dist;
-          }
-          else {
-            TERN_(HAS_EXTRUDERS, dest.e = end.e);
-            dest.z = end.z;
-          }
-
-          dest.z += z0;
-          planner.buffer_segment(dest, scaled_fr_mm_s, extruder);
-
-        }
-        else
-          DEBUG_ECHOLNPGM("[ubl] skip Y segment");
+    if (cell_indexes(start) != cell_indexes(end)) {
+      const xyze_float_t total = end - start;
+      const float fade_scaling_factor = planner.fade_scaling_factor_for_z(end.z);
+      mesh_line_walker walker(start, end);
+      xy_pos_t pos;
+      float t, z0;
+      while (walker.next(pos, t, z0)) {
+        xyze_pos_t dest = start + total * t;
+        dest.set(pos.x, pos.y);
+        dest.z += z0 * fade_scaling_factor;
+        if (!planner.buffer_segment(dest, scaled_fr_mm_s, extruder)) break;
       }
-
-      // At the final destination? Usually not, but when on a Y Mesh Line it's completed.
-      if (xy_pos_t(current_position) != xy_pos_t(end))
-        goto FINAL_MOVE;
-
-      current_position = destination;
-      return;
     }
 
-    /**
-     * Handle horizontal lines that stay within one row.
-     * These need not be perfectly horizontal.
-     */
-    if (iadd.y == 0) {      // Horizontal line?
-      icell.x += ineg.x;     // Heading left? Just go to the left edge of the cell for the first move.
-
-      while (icell.x != iend.x + ineg.x) {
-        icell.x += iadd.x;
-        dest.x = get_mesh_x(icell.x);
-        dest.y = ratio * dest.x + c;    // Calculate Y at the next X mesh line
-
-        float z0 = z_correction_for_y_on_vertical_mesh_line(dest.y, icell.x, icell.y)
-                     * planner.fade_scaling_factor_for_z(end.z);
-
-        // Undefined parts of the Mesh in z_values[][] are NAN.
-        // Replace NAN corrections with 0.0 to prevent NAN propagation.
-        if (isnan(z0)) z0 = 0.0;
-
-        /**
-         * Without this check, it's possible to generate a zero length move, as in the case where
-         * the line is heading left, starting exactly on a mesh line boundary. Since this is rare
-         * it might be fine to remove this check and let planner.buffer_segment() filter it out.
-         */
-        if (dest.x != start.x) {
-          if (!inf_normalized_flag) {
-            on_axis_distance = use_x_dist ? dest.x - start.x : dest.y - start.y;
-            TERN_(HAS_EXTRUDERS, dest.e = start.e + on_axis_distance * e_normalized_dist); // Based on X or Y because the move is horizontal
-            dest.z = start.z + on_axis_distance * z_normalized_dist;
-          }
-          else {
-            TERN_(HAS_EXTRUDERS, dest.e = end.e);
-            dest.z = end.z;
-          }
-
-          dest.z += z0;
-          if (!planner.buffer_segment(dest, scaled_fr_mm_s, extruder)) break;
-
-        }
-        else
-          DEBUG_ECHOLNPGM("[ubl] skip Y segment");
-      }
-
-      if (xy_pos_t(current_position) != xy_pos_t(end))
-        goto FINAL_MOVE;
+    const xy_uint8_t iend = cell_indexes(end);
 
-      current_position = destination;
-      return;
-    }
-
-    /**
-     * Generic case of a line crossing both X and Y Mesh lines.
-     */
+    // When UBL_Z_RAISE_WHEN_OFF_MESH is disabled Z correction is extrapolated from the edge of the mesh
+    #ifdef UBL_Z_RAISE_WHEN_OFF_MESH
+      // For a move off the UBL mesh, use a constant Z raise
+      if (!cell_index_x_valid(end.x) || !cell_index_y_valid(end.y)) {
 
-    xy_uint8_t cnt = istart.diff(iend);
+        // Note: There is no Z Correction in this case. We are off the mesh and don't know what
+        // a reasonable correction would be, UBL_Z_RAISE_WHEN_OFF_MESH will be used instead of
+        // a calculated (Bi-Linear interpolation) correction.
 
-    icell += ineg;
-
-    while (cnt) {
-
-      const float next_mesh_line_x = get_mesh_x(icell.x + iadd.x),
-                  next_mesh_line_y = get_mesh_y(icell.y + iadd.y);
-
-      dest.y = ratio * next_mesh_line_x + c;    // Calculate Y at the next X mesh line
-      dest.x = (next_mesh_line_y - c) / ratio;  // Calculate X at the next Y mesh line
-                                                // (No need to worry about ratio == 0.
-                                                //  In that case, it was already detected
-                                                //  as a vertical line move above.)
-
-      if (neg.x == (dest.x > next_mesh_line_x)) { // Check if we hit the Y line first
-        // Yes!  Crossing a Y Mesh Line next
-        float z0 = z_correction_for_x_on_horizontal_mesh_line(dest.x, icell.x - ineg.x, icell.y + iadd.y)
-                   * planner.fade_scaling_factor_for_z(end.z);
-
-        // Undefined parts of the Mesh in z_values[][] are NAN.
-        // Replace NAN corrections with 0.0 to prevent NAN propagation.
-        if (isnan(z0)) z0 = 0.0;
-
-        dest.y = next_mesh_line_y;
-
-        if (!inf_normalized_flag) {
-          on_axis_distance = use_x_dist ? dest.x - start.x : dest.y - start.y;
-          TERN_(HAS_EXTRUDERS, dest.e = start.e + on_axis_distance * e_normalized_dist);
-          dest.z = start.z + on_axis_distance * z_normalized_dist;
-        }
-        else {
-          TERN_(HAS_EXTRUDERS, dest.e = end.e);
-          dest.z = end.z;
-        }
-
-        dest.z += z0;
-        if (!planner.buffer_segment(dest, scaled_fr_mm_s, extruder)) break;
-
-        icell.y += iadd.y;
-        cnt.y--;
-      }
-      else {
-        // Yes!  Crossing a X Mesh Line next
-        float z0 = z_correction_for_y_on_vertical_mesh_line(dest.y, icell.x + iadd.x, icell.y - ineg.y)
-                   * planner.fade_scaling_factor_for_z(end.z);
-
-        // Undefined parts of the Mesh in z_values[][] are NAN.
-        // Replace NAN corrections with 0.0 to prevent NAN propagation.
-        if (isnan(z0)) z0 = 0.0;
-
-        dest.x = next_mesh_line_x;
-
-        if (!inf_normalized_flag) {
-          on_axis_distance = use_x_dist ? dest.x - start.x : dest.y - start.y;
-          TERN_(HAS_EXTRUDERS, dest.e = start.e + on_axis_distance * e_normalized_dist);
-          dest.z = start.z + on_axis_distance * z_normalized_dist;
-        }
-        else {
-          TERN_(HAS_EXTRUDERS, dest.e = end.e);
-          dest.z = end.z;
-        }
-
-        dest.z += z0;
-        if (!planner.buffer_segment(dest, scaled_fr_mm_s, extruder)) break;
-
-        icell.x += iadd.x;
-        cnt.x--;
+        end.z += UBL_Z_RAISE_WHEN_OFF_MESH;
+        planner.buffer_segment(end, scaled_fr_mm_s, extruder);
+        current_position = destination;
+        return;
       }
+    #endif
 
-      if (cnt.x < 0 || cnt.y < 0) break; // Too far! Exit the loop and go to FINAL_MOVE
-    }
+    // The distance is always MESH_X_DIST so multiply by the constant reciprocal.
+    const float xratio = (end.x - get_mesh_x(iend.x)) * RECIPROCAL(MESH_X_DIST),
+                yratio = (end.y - get_mesh_y(iend.y)) * RECIPROCAL(MESH_Y_DIST),
+                z1 = z_values[iend.x][iend.y    ] + xratio * (z_values[iend.x + 1][iend.y    ] - z_values[iend.x][iend.y    ]),
+                z2 = z_values[iend.x][iend.y + 1] + xratio * (z_values[iend.x + 1][iend.y + 1] - z_values[iend.x][iend.y + 1]);
 
-    if (xy_pos_t(current_position) != xy_pos_t(end))
-      goto FINAL_MOVE;
+    // X cell-fraction done. Interpolate the two Z offsets with the Y fraction for the final Z offset.
+    const float z0 = (z1 + (z2 - z1) * yratio) * planner.fade_scaling_factor_for_z(end.z);
 
+    // Undefined parts of the Mesh in z_values[][] are NAN.
+    // Replace NAN corrections with 0.0 to prevent NAN propagation.
+    if (!isnan(z0)) end.z += z0;
+    planner.buffer_segment(end, scaled_fr_mm_s, extruder);
     current_position = destination;
   }
 
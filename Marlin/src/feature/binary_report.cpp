@@ -0,0 +1,186 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * binary_report.cpp - Compact binary status reports
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_REPORTS)
+
+#include "binary_report.h"
+#include "../gcode/queue.h"
+#include "../module/endstops.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+#include "../module/temperature.h"
+
+BinaryReport binary_report;
+
+uint8_t BinaryReport::sections = BinaryReport::REPORT_ALL;
+#if HAS_MULTI_SERIAL
+  SerialMask BinaryReport::report_port_mask = SerialMask(0);
+#endif
+uint16_t BinaryReport::interval_ms;
+millis_t BinaryReport::next_report_ms;
+
+#define REPORT_TEMP_COUNT (HOTENDS + ENABLED(HAS_HEATED_BED) + ENABLED(HAS_TEMP_CHAMBER))
+
+void BinaryReport::report() {
+  uint8_t frame[3 + 4 + 1
+    + 1 + (REPORT_TEMP_COUNT) * 4
+    + 1 + (LOGICAL_AXES) * 4
+    + 2 + 4 + 2
+  ];
+  uint8_t len = 3;
+
+  auto put8  = [&](const uint8_t v) { frame[len++] = v; };
+  auto put16 = [&](const uint16_t v) { put8(v & 0xFF); put8(v >> 8); };
+  auto put32 = [&](const uint32_t v) { put16(v & 0xFFFF); put16(v >> 16); };
+
+  put32(millis());
+  put8(sections);
+
+  #if REPORT_TEMP_COUNT
+    if (sections & REPORT_TEMPS) {
+      auto put_temp = [&](const celsius_float_t c, const celsius_t t) { put16(int16_t(LROUND(c * 10))); put16(int16_t(t * 10)); };
+      put8(REPORT_TEMP_COUNT);
+      HOTEND_LOOP() put_temp(thermalManager.degHotend(e), thermalManager.degTargetHotend(e));
+      TERN_(HAS_HEATED_BED, put_temp(thermalManager.degBed(), thermalManager.degTargetBed()));
+      TERN_(HAS_TEMP_CHAMBER, put_temp(thermalManager.degChamber(), TERN0(HAS_HEATED_CHAMBER, thermalManager.degTargetChamber())));
+    }
+  #else
+    if (sections & REPORT_TEMPS) put8(0);
+  #endif
+
+  if (sections & REPORT_POSITION) {
+    // The real position, as reported by M114 R
+    get_cartesian_from_steppers();
+    xyze_pos_t npos = LOGICAL_AXIS_ARRAY(
+      planner.get_axis_position_mm(E_AXIS),
+      cartes.x, cartes.y, cartes.z,
+      cartes.i, cartes.j, cartes.k,
+      cartes.u, cartes.v, cartes.w
+    );
+    TERN_(HAS_POSITION_MODIFIERS, planner.unapply_modifiers(npos, true));
+    const xyze_pos_t lpos = npos.asLogical();
+    put8(LOGICAL_AXES);
+    LOOP_LOGICAL_AXES(i) put32(uint32_t(int32_t(LROUND(lpos[i] * 1000))));
+  }
+
+  if (sections & REPORT_BUFFERS) {
+    put8(planner.moves_free());
+    put8(queue.ring_buffer.free_slots());
+  }
+
+  if (sections & REPORT_ENDSTOPS) put32(endstops.state());
+
+  send_frame(0x52, frame, len - 3);
+}
+
+uint16_t BinaryReport::checksum(const uint8_t * const frame) {
+  // Fletcher-16, as used by the binary file transfer protocol
+  const uint8_t len = frame[2] + 3;
+  uint16_t lo = 0, hi = 0;
+  for (uint8_t i = 2; i < len; ++i) { lo = (lo + frame[i]) % 255; hi = (hi + lo) % 255; }
+  return (hi << 8) | lo;
+}
+
+uint8_t BinaryReport::seal_frame(const uint8_t type, uint8_t * const frame, const uint8_t payload_len) {
+  const uint8_t len = payload_len + 3;
+  frame[0] = 0xB5;
+  frame[1] = type;
+  frame[2] = payload_len;
+  const uint16_t sum = checksum(frame);
+  frame[len] = sum & 0xFF;
+  frame[len + 1] = sum >> 8;
+  return len + 2;
+}
+
+void BinaryReport::send_frame(const uint8_t type, uint8_t * const frame, const uint8_t payload_len) {
+  const uint8_t len = seal_frame(type, frame, payload_len);
+  for (uint8_t i = 0; i < len; ++i) SERIAL_CHAR(frame[i]);
+}
+
+#if ENABLED(POSITION_TELEMETRY)
+
+  PositionTelemetry position_telemetry;
+
+  PositionTelemetry::sample_t PositionTelemetry::samples[POSITION_TELEMETRY_BUFFER];
+  volatile uint8_t PositionTelemetry::head, PositionTelemetry::tail, PositionTelemetry::dropped;
+  uint8_t PositionTelemetry::dropped_sent;
+  uint16_t PositionTelemetry::divider, PositionTelemetry::countdown;
+
+  void PositionTelemetry::set_rate(const uint16_t hz) {
+    const uint16_t div = hz ? _MAX(1U, uint16_t((TEMP_TIMER_FREQUENCY) / hz)) : 0;
+    hal.isr_off();
+    divider = countdown = div;
+    head = tail = dropped = dropped_sent = 0;
+    hal.isr_on();
+  }
+
+  void PositionTelemetry::sample() {
+    if (!divider || --countdown) return;
+    countdown = divider;
+    const uint8_t h = head, next = (h + 1) & (POSITION_TELEMETRY_BUFFER - 1);
+    if (next == tail) { dropped = dropped + 1; return; }
+    samples[h].ms = millis();
+    samples[h].steps = stepper.position();
+    head = next;
+  }
+
+  void PositionTelemetry::tick() {
+    constexpr uint8_t sample_size = 4 + 4 * (LOGICAL_AXES),
+                      max_count = _MIN(POSITION_TELEMETRY_BUFFER - 1, (255 - 3) / sample_size);
+    uint8_t frame[3 + 3 + max_count * sample_size + 2];
+
+    // Only send the samples already taken, so a fast sample rate can't hold idle() here
+    const uint8_t h = head;
+
+    PORT_REDIRECT(binary_report.report_port_mask);
+    while (h != tail) {
+      uint8_t len = 3, count = 0;
+      auto put32 = [&](const uint32_t v) { for (uint8_t i = 0; i < 4; ++i) frame[len++] = uint8_t(v >> (i * 8)); };
+
+      const uint8_t d = dropped;
+      frame[len++] = d - dropped_sent;
+      dropped_sent = d;
+      len++;  // count
+      frame[len++] = LOGICAL_AXES;
+      for (uint8_t t = tail; t != h && count < max_count; t = (t + 1) & (POSITION_TELEMETRY_BUFFER - 1), ++count) {
+        put32(samples[t].ms);
+        LOOP_LOGICAL_AXES(i) put32(uint32_t(samples[t].steps[i]));
+      }
+      // Free the slots only after they have been copied
+      tail = (tail + count) & (POSITION_TELEMETRY_BUFFER - 1);
+      frame[4] = count;
+
+      BinaryReport::send_frame(0x54, frame, len - 3);
+    }
+    PORT_RESTORE();
+  }
+
+#endif // POSITION_TELEMETRY
+
+#endif // BINARY_REPORTS
@@ -0,0 +1,173 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * binary_report.h - Compact binary status reports
+ *
+ * A host that finds "Cap:BINARY_REPORTS:1" in the M115 report can ask for
+ * these frames with M156 and receive temperatures, position, buffer and
+ * endstop states at up to 100Hz in a fraction of the text report size.
+ * Frames only go to the port that sent M156, between lines of text.
+ *
+ *   0xB5 0x52         Frame start
+ *   uint8  length     Payload length
+ *   payload
+ *     uint32 ms       millis() at the time of the report
+ *     uint8  sections Bitmask of the sections that follow, in bit order:
+ *     [TEMPS]         uint8 count, count x { int16 current, int16 target } in 0.1°C
+ *                     for the hotends, then the bed and chamber (if present)
+ *     [POSITION]      uint8 count, count x int32 logical position in µm (axes, then E)
+ *     [BUFFERS]       uint8 free planner blocks, uint8 free command slots
+ *     [ENDSTOPS]      uint32 live endstop bits, as in Endstops::state()
+ *   uint16 checksum   Fletcher-16 over the length and payload bytes
+ *
+ * With POSITION_TELEMETRY, M156 T<Hz> samples the stepper positions at a fixed
+ * rate in the temperature ISR and streams them in batches from idle():
+ *
+ *   0xB5 0x54         Frame start
+ *   uint8  length     Payload length
+ *   payload
+ *     uint8  dropped  Samples lost to a full buffer since the last frame (mod 256)
+ *     uint8  count    Number of samples in this frame
+ *     uint8  axes     Number of positions per sample (axes, then E)
+ *     count x { uint32 ms, axes x int32 steps }
+ *   uint16 checksum   Fletcher-16 over the length and payload bytes
+ *
+ * With BINARY_MESH, M157 sends the bed mesh as one header frame followed by
+ * one frame per row. M157 S saves the same frames to BINARY_MESH_FILE on the
+ * media and M157 L loads them back:
+ *
+ *   0xB5 0x4D         Frame start (mesh header)
+ *   uint8  length     Payload length
+ *   payload
+ *     uint8  version  Format version, currently 1
+ *     uint8  flags    1=Leveling active 2=Mesh valid
+ *     uint8  nx, ny   Grid points in X and Y
+ *     int32  x, y     Native position of the first point in µm
+ *     int32  dx, dy   Grid spacing in µm
+ *     int16  hotend   Hotend 0 temperature in 0.1°C, or INT16_MIN if absent
+ *     int16  bed      Bed temperature in 0.1°C, or INT16_MIN if absent
+ *     uint32 ms       millis() at the time of the export
+ *   uint16 checksum
+ *
+ *   0xB5 0x6D         Frame start (mesh row)
+ *   uint8  length     Payload length
+ *   payload
+ *     uint8  row      Y index of the row
+ *     uint8  count    Number of points in the row (nx)
+ *     count x int16   Z in µm from X index 0 upward, INT16_MAX for an unprobed point.
+ *                     Z beyond ±32.766mm is clamped, with a warning.
+ *   uint16 checksum
+ *
+ * Also with BINARY_MESH, M48 B sends the probe repeatability samples:
+ *
+ *   0xB5 0x50         Frame start (probe samples)
+ *   uint8  length     Payload length
+ *   payload
+ *     int32  x, y     Native probe position in µm
+ *     uint32 ms       millis() at the end of the test
+ *     uint8  count    Number of samples
+ *     count x int16   Z of each sample in µm, clamped like the mesh
+ *   uint16 checksum
+ *
+ * All multi-byte values are little-endian.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class BinaryReport {
+public:
+  enum Section : uint8_t {
+    REPORT_TEMPS    = _BV(0),
+    REPORT_POSITION = _BV(1),
+    REPORT_BUFFERS  = _BV(2),
+    REPORT_ENDSTOPS = _BV(3),
+    REPORT_ALL      = _BV(4) - 1
+  };
+
+  static constexpr uint16_t min_interval_ms = 10;
+
+  static uint8_t sections;
+  #if HAS_MULTI_SERIAL
+    static SerialMask report_port_mask;
+  #endif
+
+  static void set_interval(const uint16_t ms) {
+    interval_ms = ms ? _MAX(ms, min_interval_ms) : 0;
+    next_report_ms = millis() + interval_ms;
+  }
+
+  // Send one frame to the current serial port(s)
+  static void report();
+
+  // Frame and send a payload. Leave 3 bytes free at the start of the buffer and 2 at the end.
+  static void send_frame(const uint8_t type, uint8_t * const frame, const uint8_t payload_len);
+
+  // Fill in the header and checksum of a frame, as above. Return the full frame length.
+  static uint8_t seal_frame(const uint8_t type, uint8_t * const frame, const uint8_t payload_len);
+
+  // Fletcher-16 over the length and payload bytes of a frame, low byte first
+  static uint16_t checksum(const uint8_t * const frame);
+
+  static void tick() {
+    if (!interval_ms) return;
+    const millis_t ms = millis();
+    if (ELAPSED(ms, next_report_ms)) {
+      next_report_ms = ms + interval_ms;
+      PORT_REDIRECT(report_port_mask);
+      report();
+      PORT_RESTORE();
+    }
+  }
+
+private:
+  static uint16_t interval_ms;
+  static millis_t next_report_ms;
+};
+
+extern BinaryReport binary_report;
+
+#if ENABLED(POSITION_TELEMETRY)
+
+  class PositionTelemetry {
+  public:
+    // Sample every 'rate' Hz, up to TEMP_TIMER_FREQUENCY. 0 to stop.
+    static void set_rate(const uint16_t hz);
+
+    // Called from the temperature ISR
+    static void sample();
+
+    // Send the buffered samples. Called from idle().
+    static void tick();
+
+  private:
+    struct sample_t { uint32_t ms; xyze_long_t steps; };
+    static sample_t samples[POSITION_TELEMETRY_BUFFER];
+    static volatile uint8_t head, tail, dropped;  // 'dropped' only counts up, wrapping at 256
+    static uint8_t dropped_sent;
+    static uint16_t divider, countdown;
+  };
+
+  extern PositionTelemetry position_telemetry;
+
+#endif
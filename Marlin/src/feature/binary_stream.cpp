@@ -30,6 +30,10 @@
 char* SDFileTransferProtocol::Packet::Open::data = nullptr;
 size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
 bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
+#if ENABLED(BINARY_STREAM_COMPRESSION)
+  uint8_t SDFileTransferProtocol::fill_index, SDFileTransferProtocol::buffers_full;
+  bool SDFileTransferProtocol::write_error;
+#endif
 
 BinaryStream binaryStream[NUM_SERIAL];
 
@@ -27,7 +27,7 @@
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   #include "../libs/heatshrink/heatshrink_decoder.h"
   // STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
-  static __attribute__((aligned(sizeof(size_t)))) uint8_t decode_buffer[512] = {};
+  static __attribute__((aligned(sizeof(size_t)))) uint8_t decode_buffer[BINARY_STREAM_WRITE_BUFFERS][512] = {};
   static heatshrink_decoder hsd;
 #endif
 
@@ -51,6 +51,9 @@ private:
         return *reinterpret_cast<Open*>(buffer);
       }
       bool compression_enabled() { return compression & 0x1; }
+      // Optional heatshrink settings used by the host, with 0 for the defaults
+      uint8_t window_bits() { return compression >> 4; }
+      uint8_t lookahead_bits() { const uint8_t la = (compression >> 1) & 0x7; return la ? la + 2 : 0; }
       bool dummy_transfer() { return dummy & 0x1; }
       static char* filename() { return data; }
       private:
@@ -67,12 +70,51 @@ private:
     }
     transfer_active = true;
     data_waiting = 0;
-    TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_reset(&hsd));
+    #if ENABLED(BINARY_STREAM_COMPRESSION)
+      fill_index = 0;
+      buffers_full = 0;
+      write_error = false;
+    #endif
     return true;
   }
 
+  #if ENABLED(BINARY_STREAM_COMPRESSION)
+
+    // Write the oldest full decode buffer to the file
+    static bool write_full_buffer() {
+      const uint8_t i = (fill_index + BINARY_STREAM_WRITE_BUFFERS - buffers_full) % (BINARY_STREAM_WRITE_BUFFERS);
+      buffers_full--;
+      if (!dummy_transfer && card.write(decode_buffer[i], sizeof(decode_buffer[i])) < 0) write_error = true;
+      return !write_error;
+    }
+
+    static bool flush_full_buffers() {
+      while (buffers_full) if (!write_full_buffer()) return false;
+      return true;
+    }
+
+    // Account for 'count' new bytes in the current buffer and move on when it's full
+    static bool buffer_filled(const size_t count) {
+      data_waiting += count;
+      if (data_waiting < sizeof(decode_buffer[0])) return true;
+      data_waiting = 0;
+      fill_index = (fill_index + 1) % (BINARY_STREAM_WRITE_BUFFERS);
+      // The next buffer to fill must be written out first
+      return ++buffers_full < BINARY_STREAM_WRITE_BUFFERS || write_full_buffer();
+    }
+
+  #endif
+
+  /**
+   * Upload data, decompressed if needed, is collected in 512-byte buffers. With more
+   * than one buffer the full ones are written to SD from idle(), between packets, so
+   * the SD write overlaps with receiving (and decompressing) the next packet. The
+   * writer only waits for the SD card when every buffer is full.
+   */
   static bool file_write(char *buffer, const size_t length) {
     #if ENABLED(BINARY_STREAM_COMPRESSION)
+      if (write_error) return false;
+
       if (compression) {
         size_t total_processed = 0, processed_count = 0;
         HSD_poll_res presult;
@@ -81,29 +123,33 @@ private:
           heatshrink_decoder_sink(&hsd, reinterpret_cast<uint8_t*>(&buffer[total_processed]), length - total_processed, &processed_count);
           total_processed += processed_count;
           do {
-            presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting, &processed_count);
-            data_waiting += processed_count;
-            if (data_waiting == sizeof(decode_buffer)) {
-              if (!dummy_transfer)
-                if (card.write(decode_buffer, data_waiting) < 0) {
-                  return false;
-                }
-              data_waiting = 0;
-            }
+            uint8_t * const out = decode_buffer[fill_index];
+            presult = heatshrink_decoder_poll(&hsd, &out[data_waiting], sizeof(decode_buffer[0]) - data_waiting, &processed_count);
+            if (!buffer_filled(processed_count)) return false;
           } while (presult == HSDR_POLL_MORE);
         }
-        return true;
       }
+      else {
+        for (size_t total_copied = 0; total_copied < length;) {
+          const size_t count = _MIN(length - total_copied, sizeof(decode_buffer[0]) - data_waiting);
+          memcpy(&decode_buffer[fill_index][data_waiting], &buffer[total_copied], count);
+          total_copied += count;
+          if (!buffer_filled(count)) return false;
+        }
+      }
+      return true;
+    #else
+      return (dummy_transfer || card.write(buffer, length) >= 0);
     #endif
-    return (dummy_transfer || card.write(buffer, length) >= 0);
   }
 
   static bool file_close() {
     if (!dummy_transfer) {
       #if ENABLED(BINARY_STREAM_COMPRESSION)
         // flush any buffered data
+        if (write_error || !flush_full_buffers()) return false;
         if (data_waiting) {
-          if (card.write(decode_buffer, data_waiting) < 0) return false;
+          if (card.write(decode_buffer[fill_index], data_waiting) < 0) return false;
           data_waiting = 0;
         }
       #endif
@@ -122,6 +168,7 @@ private:
       card.release();
       TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_finish(&hsd));
     }
+    TERN_(BINARY_STREAM_COMPRESSION, buffers_full = 0);
     transfer_active = false;
     return;
   }
@@ -130,10 +177,19 @@ private:
 
   static size_t data_waiting, transfer_timeout, idle_timeout;
   static bool transfer_active, dummy_transfer, compression;
+  #if ENABLED(BINARY_STREAM_COMPRESSION)
+    static uint8_t fill_index, buffers_full;
+    static bool write_error;
+  #endif
 
 public:
 
   static void idle() {
+    // Write one full buffer while waiting for the next packet
+    #if ENABLED(BINARY_STREAM_COMPRESSION)
+      if (transfer_active && buffers_full) write_full_buffer();
+    #endif
+
     // If a transfer is interrupted and a file is left open, abort it after 'idle_period' ms
     const millis_t ms = millis();
     if (transfer_active && ELAPSED(ms, idle_timeout)) {
@@ -148,7 +204,7 @@ public:
       case FileTransfer::QUERY:
         SERIAL_ECHO(F("PFT:version:"), version_major, C('.'), version_minor, C('.'), version_patch);
         #if ENABLED(BINARY_STREAM_COMPRESSION)
-          SERIAL_ECHOLN(F(":compression:heatshrink,"), HEATSHRINK_STATIC_WINDOW_BITS, C(','), HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+          SERIAL_ECHOLN(F(":compression:heatshrink,"), BINARY_STREAM_WINDOW_BITS, C(','), BINARY_STREAM_LOOKAHEAD_BITS);
         #else
           SERIAL_ECHOLNPGM(":compression:none");
         #endif
@@ -161,6 +217,15 @@ public:
             auto packet = Packet::Open::decode(buffer);
             compression = packet.compression_enabled();
             dummy_transfer = packet.dummy_transfer();
+            #if ENABLED(BINARY_STREAM_COMPRESSION)
+              // Use the window and lookahead requested by the host, up to the configured window
+              const uint8_t wbits = packet.window_bits() ?: BINARY_STREAM_WINDOW_BITS,
+                            lbits = packet.lookahead_bits() ?: _MIN(BINARY_STREAM_LOOKAHEAD_BITS, wbits - 1);
+              if (!heatshrink_decoder_configure(&hsd, wbits, lbits)) {
+                SERIAL_ECHOLNPGM("PFT:fail");
+                break;
+              }
+            #endif
             if (file_open(packet.filename())) {
               SERIAL_ECHOLNPGM("PFT:success");
               break;
@@ -194,7 +259,7 @@ public:
     }
   }
 
-  static const uint16_t version_major = 0, version_minor = 1, version_patch = 0, timeout = 10000, idle_period = 1000;
+  static const uint16_t version_major = 0, version_minor = 2, version_patch = 0, timeout = 10000, idle_period = 1000;
 };
 
 class BinaryStream {
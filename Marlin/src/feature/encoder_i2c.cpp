@@ -50,13 +50,23 @@ void I2CPositionEncoder::init(const uint8_t address, const AxisEnum axis) {
 
   SERIAL_ECHOLNPGM("Setting up encoder on ", C(AXIS_CHAR(encoderAxis)), " axis, addr = ", address);
 
+  sampleSteps = stepper.position(encoderAxis);
   position = get_position();
 }
 
 void I2CPositionEncoder::update() {
   if (!initialized || !homed || !active) return; //check encoder is set up and active
 
-  position = get_position();
+  // Keep the stepper position and time from when the encoder was read, to compare like with like
+  #if ENABLED(I2CPE_ASYNC_READ)
+    position = rxCount - zeroOffset;
+    sampleSteps = rxSteps;
+    sampleTime = rxStartTime;
+  #else
+    sampleSteps = stepper.position(encoderAxis);
+    sampleTime = millis();
+    position = get_position();
+  #endif
 
   //we don't want to stop things just because the encoder missed a message,
   //so we only care about responses that indicate bad magnetic strength
@@ -113,7 +123,7 @@ void I2CPositionEncoder::update() {
   }
 
   lastPosition = position;
-  const millis_t positionTime = millis();
+  const millis_t positionTime = sampleTime;
 
   //only do error correction if setup and enabled
   if (ec && ecMethod != I2CPE_ECM_NONE) {
@@ -238,7 +248,7 @@ bool I2CPositionEncoder::passes_test(const bool report) {
 }
 
 float I2CPositionEncoder::get_axis_error_mm(const bool report) {
-  const float target = planner.get_axis_position_mm(encoderAxis),
+  const float target = sampleSteps * planner.mm_per_step[encoderAxis],
               actual = mm_from_count(position),
               diff = actual - target,
               error = ABS(diff) > 10000 ? 0 : diff; // Huge error is a bad reading
@@ -268,7 +278,8 @@ int32_t I2CPositionEncoder::get_axis_error_steps(const bool report) {
   //convert both 'ticks' into same units / base
   encoderCountInStepperTicksScaled = LROUND((stepperTicksPerUnit * encoderTicks) / encoderTicksPerUnit);
 
-  const int32_t target = stepper.position(encoderAxis);
+  // Compare with where the steppers were when the encoder was read
+  const int32_t target = sampleSteps;
   int32_t error = encoderCountInStepperTicksScaled - target;
 
   //suppress discontinuities (might be caused by bad I2C readings...?)
@@ -288,10 +299,7 @@ int32_t I2CPositionEncoder::get_axis_error_steps(const bool report) {
 }
 
 int32_t I2CPositionEncoder::get_raw_count() {
-  uint8_t index = 0;
-  i2cLong encoderCount;
-
-  encoderCount.val = 0x00;
+  I2CPositionEncodersMgr::wait_for_bus();
 
   if (Wire.requestFrom(I2C_ADDRESS(i2cAddress), uint8_t(3)) != 3) {
     //houston, we have a problem...
@@ -299,8 +307,15 @@ int32_t I2CPositionEncoder::get_raw_count() {
     return 0;
   }
 
-  while (Wire.available())
-    encoderCount.bval[index++] = (uint8_t)Wire.read();
+  uint8_t bytes[3];
+  for (uint8_t i = 0; i < 3; ++i) bytes[i] = (uint8_t)Wire.read();
+  return decode_count(bytes);
+}
+
+int32_t I2CPositionEncoder::decode_count(uint8_t (&bytes)[3]) {
+  i2cLong encoderCount;
+  encoderCount.val = 0x00;
+  for (uint8_t i = 0; i < 3; ++i) encoderCount.bval[i] = bytes[i];
 
   //extract the magnetic strength
   H = (B00000011 & (encoderCount.bval[2] >> 6));
@@ -314,6 +329,41 @@ int32_t I2CPositionEncoder::get_raw_count() {
   return encoderCount.val;
 }
 
+#if ENABLED(I2CPE_ASYNC_READ)
+
+  // The STM32 HAL reads by interrupt on the peripheral set up by Wire.begin()
+
+  bool I2CPositionEncoder::start_read() {
+    if (!initialized || !homed || !active) return false;
+    I2C_HandleTypeDef * const hi2c = Wire.getHandle();
+    if (HAL_I2C_GetState(hi2c) != HAL_I2C_STATE_READY) return false;
+    if (HAL_I2C_Master_Receive_IT(hi2c, uint16_t(I2C_ADDRESS(i2cAddress)) << 1, rxBuffer, sizeof(rxBuffer)) != HAL_OK) return false;
+    rxBusy = true;
+    rxSteps = stepper.position(encoderAxis);
+    rxStartTime = millis();
+    return true;
+  }
+
+  bool I2CPositionEncoder::read_done() {
+    if (!rxBusy) return true;
+    I2C_HandleTypeDef * const hi2c = Wire.getHandle();
+    if (HAL_I2C_GetState(hi2c) == HAL_I2C_STATE_READY)
+      rxCount = HAL_I2C_GetError(hi2c) == HAL_I2C_ERROR_NONE ? decode_count(rxBuffer) : (H = I2CPE_MAG_SIG_NF, 0);
+    else if (ELAPSED(millis(), rxStartTime + 10)) {
+      // A stuck bus. Reset the peripheral and report no signal.
+      Wire.end();
+      Wire.begin();
+      H = I2CPE_MAG_SIG_NF;
+      rxCount = 0;
+    }
+    else
+      return false;
+    rxBusy = false;
+    return true;
+  }
+
+#endif
+
 bool I2CPositionEncoder::test_axis() {
   // Only works on XYZ Cartesian machines for the time being
   if (!(encoderAxis == X_AXIS || encoderAxis == Y_AXIS || encoderAxis == Z_AXIS)) return false;
@@ -446,6 +496,7 @@ void I2CPositionEncoder::calibrate_steps_mm(const uint8_t iter) {
 }
 
 void I2CPositionEncoder::reset() {
+  I2CPositionEncodersMgr::wait_for_bus();
   Wire.beginTransmission(I2C_ADDRESS(i2cAddress));
   Wire.write(I2CPE_RESET_COUNT);
   Wire.endTransmission();
@@ -458,6 +509,11 @@ uint8_t I2CPositionEncodersMgr::I2CPE_addr,
         I2CPositionEncodersMgr::I2CPE_idx;
 I2CPositionEncoder I2CPositionEncodersMgr::encoders[I2CPE_ENCODER_CNT];
 
+#if ENABLED(I2CPE_ASYNC_READ)
+  uint8_t I2CPositionEncodersMgr::next; // = 0
+  bool I2CPositionEncodersMgr::reading; // = false
+#endif
+
 void I2CPositionEncodersMgr::init() {
   Wire.begin();
 
@@ -658,6 +714,8 @@ void I2CPositionEncodersMgr::report_position(const int8_t idx, const bool units,
 }
 
 void I2CPositionEncodersMgr::change_module_address(const uint8_t oldaddr, const uint8_t newaddr) {
+  wait_for_bus();
+
   // First check 'new' address is not in use
   Wire.beginTransmission(I2C_ADDRESS(newaddr));
   if (!Wire.endTransmission()) {
@@ -705,6 +763,8 @@ void I2CPositionEncodersMgr::change_module_address(const uint8_t oldaddr, const
 }
 
 void I2CPositionEncodersMgr::report_module_firmware(const uint8_t address) {
+  wait_for_bus();
+
   // First check there is a module
   Wire.beginTransmission(I2C_ADDRESS(address));
   if (Wire.endTransmission()) {
@@ -90,6 +90,18 @@
 #define I2CPE_PARSE_ERR               1
 #define I2CPE_PARSE_OK                0
 
+// On STM32 a round-robin update starts an interrupt-driven read and finishes it on a later call
+#if ALL(I2CPE_ROUND_ROBIN_UPDATE, HAL_STM32)
+  #define I2CPE_ASYNC_READ
+#endif
+
+// Time between update() calls. Round-robin keeps each encoder on I2CPE_MIN_UPD_TIME_MS.
+#if ENABLED(I2CPE_ROUND_ROBIN_UPDATE)
+  #define I2CPE_UPDATE_INTERVAL_MS    _MAX(1, (I2CPE_MIN_UPD_TIME_MS) / (I2CPE_ENCODER_CNT))
+#else
+  #define I2CPE_UPDATE_INTERVAL_MS    I2CPE_MIN_UPD_TIME_MS
+#endif
+
 #define LOOP_PE(VAR) for (uint8_t VAR = 0; VAR < I2CPE_ENCODER_CNT; ++VAR)
 #define CHECK_IDX() do{ if (!WITHIN(idx, 0, I2CPE_ENCODER_CNT - 1)) return; }while(0)
 
@@ -123,12 +135,24 @@ class I2CPositionEncoder {
 
     int32_t   zeroOffset          = 0,
               lastPosition        = 0,
-              position;
+              position,
+              sampleSteps         = 0;                   // Stepper position when 'position' was read
 
     millis_t  lastPositionTime    = 0,
+              sampleTime          = 0,                   // When 'position' was last read
               nextErrorCountTime  = 0,
               lastErrorTime;
 
+    #if ENABLED(I2CPE_ASYNC_READ)
+      uint8_t   rxBuffer[3];                             // Count bytes of a non-blocking read
+      bool      rxBusy              = false;             // A non-blocking read is in progress
+      int32_t   rxCount             = 0,                 // The count from the last non-blocking read
+                rxSteps             = 0;                 // Stepper position when the read was started
+      millis_t  rxStartTime;
+    #endif
+
+    int32_t decode_count(uint8_t (&bytes)[3]);
+
     #if ENABLED(I2CPE_ERR_ROLLING_AVERAGE)
       uint8_t errIdx = 0, errPrstIdx = 0;
       int err[I2CPE_ERR_ARRAY_SIZE] = { 0 },
@@ -141,6 +165,13 @@ class I2CPositionEncoder {
 
     void update();
 
+    #if ENABLED(I2CPE_ASYNC_READ)
+      // Start reading the count without waiting. False if the encoder is inactive or the bus is busy.
+      bool start_read();
+      // True once the read is done (or timed out) and update() can use its count
+      bool read_done();
+    #endif
+
     void set_homed();
     void set_unhomed();
 
@@ -159,6 +190,11 @@ class I2CPositionEncoder {
     FORCE_INLINE float get_position_mm() { return mm_from_count(get_position()); }
     FORCE_INLINE int32_t get_position() { return get_raw_count() - zeroOffset; }
 
+    // The position, time, and stepper position of the last reading taken by update()
+    FORCE_INLINE int32_t get_sampled_position() { return position; }
+    FORCE_INLINE millis_t get_sample_time() { return sampleTime; }
+    FORCE_INLINE int32_t get_sampled_steps() { return sampleSteps; }
+
     int32_t get_axis_error_steps(const bool report);
     float get_axis_error_mm(const bool report);
 
@@ -174,6 +210,8 @@ class I2CPositionEncoder {
     FORCE_INLINE uint8_t get_address() { return i2cAddress; }
     FORCE_INLINE void set_address(const uint8_t addr) { i2cAddress = addr; }
 
+    FORCE_INLINE bool get_homed() { return homed; }
+
     FORCE_INLINE bool get_active() { return active; }
     FORCE_INLINE void set_active(const bool a) { active = a; }
 
@@ -215,12 +253,43 @@ class I2CPositionEncodersMgr {
     static bool I2CPE_anyaxis;
     static uint8_t I2CPE_addr, I2CPE_idx;
 
+    #if ENABLED(I2CPE_ASYNC_READ)
+      static uint8_t next;    // The encoder to read next
+      static bool reading;    // encoders[next] has a read in progress
+    #endif
+
   public:
 
+    // Let a non-blocking read finish before using the bus
+    static void wait_for_bus() {
+      #if ENABLED(I2CPE_ASYNC_READ)
+        if (reading) while (!encoders[next].read_done()) { /* nada */ }
+      #endif
+    }
+
     static void init();
 
-    // consider only updating one endoder per call / tick if encoders become too time intensive
-    static void update() { LOOP_PE(i) encoders[i].update(); }
+    static void update() {
+      #if ENABLED(I2CPE_ASYNC_READ)
+        // Finish the read started on an earlier call, then start reading the next encoder
+        if (reading) {
+          if (!encoders[next].read_done()) return;
+          reading = false;
+          encoders[next].update();
+          if (++next >= I2CPE_ENCODER_CNT) next = 0;
+        }
+        if (encoders[next].start_read())
+          reading = true;
+        else if (++next >= I2CPE_ENCODER_CNT)
+          next = 0;
+      #elif ENABLED(I2CPE_ROUND_ROBIN_UPDATE)
+        static uint8_t next; // = 0
+        encoders[next].update();
+        if (++next >= I2CPE_ENCODER_CNT) next = 0;
+      #else
+        LOOP_PE(i) encoders[i].update();
+      #endif
+    }
 
     static void homed(const AxisEnum axis) {
       LOOP_PE(i)
@@ -38,6 +38,10 @@
 #include <Adafruit_NeoPixel.h>
 #include <stdint.h>
 
+#if ENABLED(NEOPIXEL_DMA)
+  #include HAL_PATH(../.., neopixel_dma.h)
+#endif
+
 // ------------------------
 // Defines
 // ------------------------
@@ -97,6 +101,9 @@ public:
   static void begin() {
     adaneo1.begin();
     TERN_(CONJOINED_NEOPIXEL, adaneo2.begin());
+    #if ENABLED(NEOPIXEL_DMA)
+      if (!NeoPixelDMA::init(NEOPIXEL_PIN)) SERIAL_ECHO_MSG("NEOPIXEL_PIN timer or DMA unavailable. NEOPIXEL_DMA disabled.");
+    #endif
   }
 
   static void set_pixel_color(const uint16_t n, const uint32_t c) {
@@ -115,6 +122,11 @@ public:
   }
 
   static void show() {
+    // Send by DMA without masking interrupts, if the pin allows it
+    #if ENABLED(NEOPIXEL_DMA)
+      if (NeoPixelDMA::show(adaneo1.getPixels())) return;
+    #endif
+
     // Some platforms cannot maintain PWM output when NeoPixel disables interrupts for long durations.
     TERN_(HAS_PAUSE_SERVO_OUTPUT, PAUSE_SERVO_OUTPUT());
     adaneo1.show();
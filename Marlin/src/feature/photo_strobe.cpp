@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PHOTO_STROBE)
+
+#include "photo_strobe.h"
+
+PhotoStrobe photo_strobe;
+
+#if !HAS_STROBE_TIMER
+  static_assert(!(PHOTO_STROBE_WIDTH_MS) || (PHOTO_STROBE_WIDTH_MS) * 1000 >= PhotoStrobe::isr_min_width_us, "PHOTO_STROBE_WIDTH_MS is too short for the Temperature ISR to time.");
+#endif
+
+volatile uint16_t PhotoStrobe::delay_ticks, // = 0
+                  PhotoStrobe::width_ticks; // = 0
+
+void PhotoStrobe::init() {
+  if (!shares_case_light()) OUT_WRITE(PHOTO_STROBE_PIN, !(PHOTO_STROBE_STATE));
+  // Without a free timer the Temperature ISR does the timing
+  TERN_(HAS_STROBE_TIMER, StrobeTimer::init(light));
+}
+
+// Temperature ISR ticks for a duration, rounded up
+static uint16_t us_to_ticks(const uint32_t us) {
+  return _MIN(uint32_t(ceilf(us * float(TEMP_TIMER_FREQUENCY) * 1e-6f)), 0xFFFFUL);
+}
+
+void PhotoStrobe::fire(const uint32_t offset_us, const uint32_t width_us) {
+  if (!width_us) return;
+
+  if (shares_case_light()) SET_OUTPUT(PHOTO_STROBE_PIN);
+
+  #if HAS_STROBE_TIMER
+    if (StrobeTimer::ready()) return StrobeTimer::start(offset_us, width_us);
+  #endif
+
+  const uint16_t dticks = us_to_ticks(offset_us), wticks = us_to_ticks(width_us);
+
+  DISABLE_TEMPERATURE_INTERRUPT();
+  if (dticks)
+    delay_ticks = dticks;
+  else
+    light(true);
+  width_ticks = wticks;
+  ENABLE_TEMPERATURE_INTERRUPT();
+}
+
+void PhotoStrobe::isr() {
+  if (delay_ticks) {
+    if (!--delay_ticks) light(true);
+  }
+  else if (width_ticks && !--width_ticks)
+    light(false);
+}
+
+#endif // PHOTO_STROBE
@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * photo_strobe.h - Light strobe timed to the M240 camera trigger
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#ifdef HAL_STM32
+  #define HAS_STROBE_TIMER 1
+  #include HAL_PATH(.., strobe_timer.h)
+#endif
+
+class PhotoStrobe {
+public:
+  static void init();
+
+  // Light up 'offset_us' from now for 'width_us'. With a hardware timer (HAL/STM32) both edges are
+  // within a few µs. Otherwise the Temperature ISR does the timing, so they may be late by up to
+  // one ISR tick (~1ms).
+  static void fire(const uint32_t offset_us, const uint32_t width_us);
+
+  // Shortest strobe whose width is within ~20% despite the ISR granularity
+  static constexpr uint32_t isr_min_width_us = (5000000UL + (TEMP_TIMER_FREQUENCY) - 1) / (TEMP_TIMER_FREQUENCY);
+
+  // Shortest strobe that fire() can time
+  static uint32_t min_width_us() { return TERN0(HAS_STROBE_TIMER, StrobeTimer::ready()) ? 2 : isr_min_width_us; }
+
+  // The strobe is still pending or lit
+  static bool busy() { return TERN0(HAS_STROBE_TIMER, StrobeTimer::busy()) || delay_ticks || width_ticks; }
+
+  // Called from the temperature ISR when there's no hardware timer
+  static void isr();
+
+  static constexpr bool shares_case_light() { return TERN0(NEED_CASE_LIGHT_PIN, PHOTO_STROBE_PIN == CASE_LIGHT_PIN); }
+
+private:
+  static volatile uint16_t delay_ticks, width_ticks;
+  static void light(const bool on) { WRITE(PHOTO_STROBE_PIN, on ? PHOTO_STROBE_STATE : !(PHOTO_STROBE_STATE)); }
+};
+
+extern PhotoStrobe photo_strobe;
@@ -53,6 +53,12 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::ui_flag_resume; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_ASYNC_WRITE)
+  PrintJobRecovery::pending_t PrintJobRecovery::pending;
+  uint8_t PrintJobRecovery::pending_sectors, // = 0
+          PrintJobRecovery::write_slot;      // = 0
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -146,6 +152,10 @@ bool PrintJobRecovery::check() {
  */
 void PrintJobRecovery::purge() {
   init();
+  #if ENABLED(POWER_LOSS_ASYNC_WRITE)
+    discard();
+    write_slot = 0;
+  #endif
   card.removeJobRecoveryFile();
 }
 
@@ -153,9 +163,23 @@ void PrintJobRecovery::purge() {
  * Load the recovery data, if it exists
  */
 void PrintJobRecovery::load() {
+  TERN_(POWER_LOSS_ASYNC_WRITE, discard());
   if (exists()) {
     open(true);
-    (void)file.read(&info, sizeof(info));
+    #if ENABLED(POWER_LOSS_ASYNC_WRITE)
+      // Load the newer of the two slots, skipping one torn by an outage
+      const bool valid0 = file.read(&info, sizeof(info)) == int16_t(sizeof(info)) && info.valid(),
+                 valid1 = file.seekSet(PLR_SLOT_SIZE)
+                       && file.read(&pending.info, sizeof(info)) == int16_t(sizeof(info)) && pending.info.valid();
+      if (valid1 && (!valid0 || int8_t(pending.info.valid_head - info.valid_head) > 0)) {
+        info = pending.info;
+        write_slot = 0;
+      }
+      else // A file too short to seek to slot 1 (e.g., saved without POWER_LOSS_ASYNC_WRITE) is rewritten from slot 0
+        write_slot = file.fileSize() >= PLR_SLOT_SIZE;
+    #else
+      (void)file.read(&info, sizeof(info));
+    #endif
     close();
   }
   debug(F("Load"));
@@ -326,7 +350,10 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
 
     // Save the current position, distance that Z was (or should be) raised,
     // and a flag whether the raise was already done here.
-    if (card.isStillPrinting()) save(true, zraise, ENABLED(BACKUP_POWER_SUPPLY));
+    if (card.isStillPrinting()) {
+      save(true, zraise, ENABLED(BACKUP_POWER_SUPPLY));
+      TERN_(POWER_LOSS_ASYNC_WRITE, flush()); // No time to wait for the main loop
+    }
 
     // Tell the LCD about the outage, even though it is about to die
     TERN_(EXTENSIBLE_UI, ExtUI::onPowerLoss());
@@ -359,13 +386,55 @@ void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  #if ENABLED(POWER_LOSS_ASYNC_WRITE)
+
+    // Snapshot the info for commit() to write out. A newer snapshot
+    // restarts the same slot, so the other slot stays intact.
+    pending.info = info;
+    pending_sectors = PLR_SLOT_SECTORS;
+
+  #else
+
+    open(false);
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+
+  #endif
 }
 
+#if ENABLED(POWER_LOSS_ASYNC_WRITE)
+
+  /**
+   * Write the next sector of the pending snapshot to its slot.
+   * Whole-sector writes go straight to the card, leaving the
+   * block cache (and the file being printed) untouched.
+   */
+  void PrintJobRecovery::commit() {
+    if (!pending_sectors) return;
+
+    if (!card.isMounted()) { pending_sectors = 0; return; }
+
+    open(false); // Stays open until purge, load, or release
+    if (!file.isOpen()) { pending_sectors = 0; return; }
+
+    const uint8_t s = PLR_SLOT_SECTORS - pending_sectors;
+    if (!file.seekSet(write_slot * PLR_SLOT_SIZE + s * 512UL) || file.write(&pending.sector[s * 512], 512) != 512) {
+      DEBUG_ECHOLNPGM("Power-loss file write failed.");
+      pending_sectors = 0;
+      return;
+    }
+
+    if (!--pending_sectors) {
+      // Flush the directory entry if the file grew
+      if (!file.sync()) DEBUG_ECHOLNPGM("Power-loss file sync failed.");
+      write_slot ^= 1;
+    }
+  }
+
+#endif
+
 /**
  * Resume the saved print job
  */
@@ -151,6 +151,12 @@ typedef struct {
 
 } job_recovery_info_t;
 
+#if ENABLED(POWER_LOSS_ASYNC_WRITE)
+  // Each copy of the recovery info occupies whole SD sectors
+  #define PLR_SLOT_SECTORS ((sizeof(job_recovery_info_t) + 511) / 512)
+  #define PLR_SLOT_SIZE (PLR_SLOT_SECTORS * 512)
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -209,6 +215,12 @@ class PrintJobRecovery {
     static void load();
     static void save(const bool force=ENABLED(SAVE_EACH_CMD_MODE), const float zraise=POWER_LOSS_ZRAISE, const bool raised=false);
 
+    #if ENABLED(POWER_LOSS_ASYNC_WRITE)
+      static void commit();
+      static void flush() { while (pending_sectors) commit(); }
+      static void discard() { pending_sectors = 0; if (file.isOpen()) close(); }
+    #endif
+
     #if PIN_EXISTS(POWER_LOSS)
       static void outage() {
         static constexpr uint8_t OUTAGE_THRESHOLD = 3;
@@ -236,6 +248,15 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_ASYNC_WRITE)
+      static union pending_t {
+        job_recovery_info_t info;
+        uint8_t sector[PLR_SLOT_SIZE];
+      } pending;                      //!< Snapshot of info being written to the file
+      static uint8_t pending_sectors, //!< Sectors of the snapshot still to write
+                     write_slot;      //!< File slot (0 or 1) receiving the snapshot
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
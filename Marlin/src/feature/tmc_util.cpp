@@ -329,92 +329,197 @@
     return should_step_down;
   }
 
-  void monitor_tmc_drivers() {
-    const millis_t ms = millis();
-
-    // Poll TMC drivers at the configured interval
-    static millis_t next_poll = 0;
-    const bool need_update_error_counters = ELAPSED(ms, next_poll);
-    if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
-
-    // Also poll at intervals for debugging
-    #if ENABLED(TMC_DEBUG)
-      static millis_t next_debug_reporting = 0;
-      const bool need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
-      if (need_debug_reporting) next_debug_reporting = ms + report_tmc_status_interval;
-    #else
-      constexpr bool need_debug_reporting = false;
-    #endif
-
-    if (need_update_error_counters || need_debug_reporting) {
+  /**
+   * Driver polling is spread over successive idle() calls, servicing one
+   * group of drivers per call so a full sweep of a multi-axis UART chain
+   * doesn't stall the command queue. Drivers sharing an axis are polled
+   * together since they step their current down together.
+   */
+  enum TMCPollGroup : uint8_t {
+    TMC_POLL_X, TMC_POLL_Y, TMC_POLL_Z,
+    TMC_POLL_I, TMC_POLL_J, TMC_POLL_K, TMC_POLL_U, TMC_POLL_V, TMC_POLL_W,
+    TMC_POLL_E0, TMC_POLL_E1, TMC_POLL_E2, TMC_POLL_E3,
+    TMC_POLL_E4, TMC_POLL_E5, TMC_POLL_E6, TMC_POLL_E7,
+    TMC_POLL_COUNT
+  };
 
+  // Poll one group of drivers. Return 'true' if any driver was accessed.
+  static bool monitor_tmc_group(const uint8_t group, const bool need_update_error_counters, const bool need_debug_reporting) {
+    switch (group) {
       #if X_IS_TRINAMIC || X2_IS_TRINAMIC
-        if ( TERN0(X_IS_TRINAMIC, monitor_tmc_driver(stepperX, need_update_error_counters, need_debug_reporting))
-          || TERN0(X2_IS_TRINAMIC, monitor_tmc_driver(stepperX2, need_update_error_counters, need_debug_reporting))
-        ) {
-          TERN_(X_IS_TRINAMIC, step_current_down(stepperX));
-          TERN_(X2_IS_TRINAMIC, step_current_down(stepperX2));
-        }
+        case TMC_POLL_X:
+          if ( TERN0(X_IS_TRINAMIC, monitor_tmc_driver(stepperX, need_update_error_counters, need_debug_reporting))
+            || TERN0(X2_IS_TRINAMIC, monitor_tmc_driver(stepperX2, need_update_error_counters, need_debug_reporting))
+          ) {
+            TERN_(X_IS_TRINAMIC, step_current_down(stepperX));
+            TERN_(X2_IS_TRINAMIC, step_current_down(stepperX2));
+          }
+          return true;
       #endif
 
       #if Y_IS_TRINAMIC || Y2_IS_TRINAMIC
-        if ( TERN0(Y_IS_TRINAMIC, monitor_tmc_driver(stepperY, need_update_error_counters, need_debug_reporting))
-          || TERN0(Y2_IS_TRINAMIC, monitor_tmc_driver(stepperY2, need_update_error_counters, need_debug_reporting))
-        ) {
-          TERN_(Y_IS_TRINAMIC, step_current_down(stepperY));
-          TERN_(Y2_IS_TRINAMIC, step_current_down(stepperY2));
-        }
+        case TMC_POLL_Y:
+          if ( TERN0(Y_IS_TRINAMIC, monitor_tmc_driver(stepperY, need_update_error_counters, need_debug_reporting))
+            || TERN0(Y2_IS_TRINAMIC, monitor_tmc_driver(stepperY2, need_update_error_counters, need_debug_reporting))
+          ) {
+            TERN_(Y_IS_TRINAMIC, step_current_down(stepperY));
+            TERN_(Y2_IS_TRINAMIC, step_current_down(stepperY2));
+          }
+          return true;
       #endif
 
       #if ANY(Z_IS_TRINAMIC, Z2_IS_TRINAMIC, Z3_IS_TRINAMIC, Z4_IS_TRINAMIC)
-        if ( TERN0(Z_IS_TRINAMIC,  monitor_tmc_driver(stepperZ,  need_update_error_counters, need_debug_reporting))
-          || TERN0(Z2_IS_TRINAMIC, monitor_tmc_driver(stepperZ2, need_update_error_counters, need_debug_reporting))
-          || TERN0(Z3_IS_TRINAMIC, monitor_tmc_driver(stepperZ3, need_update_error_counters, need_debug_reporting))
-          || TERN0(Z4_IS_TRINAMIC, monitor_tmc_driver(stepperZ4, need_update_error_counters, need_debug_reporting))
-        ) {
-          TERN_(Z_IS_TRINAMIC,  step_current_down(stepperZ));
-          TERN_(Z2_IS_TRINAMIC, step_current_down(stepperZ2));
-          TERN_(Z3_IS_TRINAMIC, step_current_down(stepperZ3));
-          TERN_(Z4_IS_TRINAMIC, step_current_down(stepperZ4));
-        }
+        case TMC_POLL_Z:
+          if ( TERN0(Z_IS_TRINAMIC,  monitor_tmc_driver(stepperZ,  need_update_error_counters, need_debug_reporting))
+            || TERN0(Z2_IS_TRINAMIC, monitor_tmc_driver(stepperZ2, need_update_error_counters, need_debug_reporting))
+            || TERN0(Z3_IS_TRINAMIC, monitor_tmc_driver(stepperZ3, need_update_error_counters, need_debug_reporting))
+            || TERN0(Z4_IS_TRINAMIC, monitor_tmc_driver(stepperZ4, need_update_error_counters, need_debug_reporting))
+          ) {
+            TERN_(Z_IS_TRINAMIC,  step_current_down(stepperZ));
+            TERN_(Z2_IS_TRINAMIC, step_current_down(stepperZ2));
+            TERN_(Z3_IS_TRINAMIC, step_current_down(stepperZ3));
+            TERN_(Z4_IS_TRINAMIC, step_current_down(stepperZ4));
+          }
+          return true;
       #endif
 
+      #define _TMC_POLL_AXIS(A) case TMC_POLL_##A: \
+        if (monitor_tmc_driver(stepper##A, need_update_error_counters, need_debug_reporting)) \
+          step_current_down(stepper##A); \
+        return true;
+
       #if I_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperI, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperI);
+        _TMC_POLL_AXIS(I)
       #endif
       #if J_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperJ, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperJ);
+        _TMC_POLL_AXIS(J)
       #endif
       #if K_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperK, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperK);
+        _TMC_POLL_AXIS(K)
       #endif
       #if U_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperU, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperU);
+        _TMC_POLL_AXIS(U)
       #endif
       #if V_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperV, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperV);
+        _TMC_POLL_AXIS(V)
       #endif
       #if W_IS_TRINAMIC
-        if (monitor_tmc_driver(stepperW, need_update_error_counters, need_debug_reporting))
-          step_current_down(stepperW);
+        _TMC_POLL_AXIS(W)
+      #endif
+
+      #undef _TMC_POLL_AXIS
+
+      #define _TMC_POLL_E(N) case TMC_POLL_E##N: (void)monitor_tmc_driver(stepperE##N, need_update_error_counters, need_debug_reporting); return true;
+
+      #if E0_IS_TRINAMIC
+        _TMC_POLL_E(0)
+      #endif
+      #if E1_IS_TRINAMIC
+        _TMC_POLL_E(1)
+      #endif
+      #if E2_IS_TRINAMIC
+        _TMC_POLL_E(2)
+      #endif
+      #if E3_IS_TRINAMIC
+        _TMC_POLL_E(3)
+      #endif
+      #if E4_IS_TRINAMIC
+        _TMC_POLL_E(4)
+      #endif
+      #if E5_IS_TRINAMIC
+        _TMC_POLL_E(5)
+      #endif
+      #if E6_IS_TRINAMIC
+        _TMC_POLL_E(6)
+      #endif
+      #if E7_IS_TRINAMIC
+        _TMC_POLL_E(7)
+      #endif
+
+      #undef _TMC_POLL_E
+
+      default: break;
+    }
+    return false;
+  }
+
+  #if ENABLED(TMC_DEBUG)
+    static struct {
+      uint32_t slice_us_max,    // Longest single idle() slice spent polling
+               slice_us_total;  // Total time spent polling in the last sweep
+      uint16_t slices;          // Number of idle() slices in the last sweep
+      millis_t sweep_ms;        // Wall time taken by the last sweep
+    } tmc_poll_stats;
+
+    void tmc_report_poll_stats() {
+      SERIAL_ECHOLNPGM("Driver poll: ", tmc_poll_stats.slices, " slices, ",
+        tmc_poll_stats.slice_us_total, "us total, ",
+        tmc_poll_stats.slice_us_max, "us max, ",
+        tmc_poll_stats.sweep_ms, "ms sweep"
+      );
+    }
+  #endif
+
+  void monitor_tmc_drivers() {
+    const millis_t ms = millis();
+
+    // Poll TMC drivers at the configured interval
+    static millis_t next_poll = 0;
+    static uint8_t poll_group = TMC_POLL_COUNT;       // Next group to poll, or TMC_POLL_COUNT when done
+    #if ENABLED(TMC_DEBUG)
+      static millis_t sweep_start_ms;
+      static uint32_t sweep_us_total, sweep_us_max;
+      static uint16_t sweep_slices;
+    #endif
+
+    if (poll_group >= TMC_POLL_COUNT) {
+      const bool need_update_error_counters = ELAPSED(ms, next_poll);
+      if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
+
+      // Also poll at intervals for debugging. Debug reports are printed in a single pass to keep lines whole.
+      #if ENABLED(TMC_DEBUG)
+        static millis_t next_debug_reporting = 0;
+        const bool need_debug_reporting = report_tmc_status_interval && ELAPSED(ms, next_debug_reporting);
+        if (need_debug_reporting) {
+          next_debug_reporting = ms + report_tmc_status_interval;
+          for (uint8_t g = 0; g < TMC_POLL_COUNT; ++g)
+            (void)monitor_tmc_group(g, need_update_error_counters, true);
+          SERIAL_EOL();
+          return;
+        }
       #endif
 
-      TERN_(E0_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE0, need_update_error_counters, need_debug_reporting));
-      TERN_(E1_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE1, need_update_error_counters, need_debug_reporting));
-      TERN_(E2_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE2, need_update_error_counters, need_debug_reporting));
-      TERN_(E3_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE3, need_update_error_counters, need_debug_reporting));
-      TERN_(E4_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE4, need_update_error_counters, need_debug_reporting));
-      TERN_(E5_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE5, need_update_error_counters, need_debug_reporting));
-      TERN_(E6_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE6, need_update_error_counters, need_debug_reporting));
-      TERN_(E7_IS_TRINAMIC, (void)monitor_tmc_driver(stepperE7, need_update_error_counters, need_debug_reporting));
+      if (!need_update_error_counters) return;
 
-      if (TERN0(TMC_DEBUG, need_debug_reporting)) SERIAL_EOL();
+      // Begin a new sweep
+      poll_group = 0;
+      #if ENABLED(TMC_DEBUG)
+        sweep_start_ms = ms;
+        sweep_us_total = sweep_us_max = 0;
+        sweep_slices = 0;
+      #endif
     }
+
+    #if ENABLED(TMC_DEBUG)
+      const uint32_t slice_start_us = micros();
+    #endif
+
+    // Poll the next group that has drivers, skipping empty ones
+    while (poll_group < TMC_POLL_COUNT)
+      if (monitor_tmc_group(poll_group++, true, false)) break;
+
+    #if ENABLED(TMC_DEBUG)
+      const uint32_t slice_us = micros() - slice_start_us;
+      sweep_us_total += slice_us;
+      NOLESS(sweep_us_max, slice_us);
+      sweep_slices++;
+      if (poll_group >= TMC_POLL_COUNT) {
+        tmc_poll_stats.slice_us_max = sweep_us_max;
+        tmc_poll_stats.slice_us_total = sweep_us_total;
+        tmc_poll_stats.slices = sweep_slices;
+        tmc_poll_stats.sweep_ms = millis() - sweep_start_ms;
+      }
+    #endif
   }
 
 #endif // MONITOR_DRIVER_STATUS
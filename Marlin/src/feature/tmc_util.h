@@ -325,6 +325,7 @@ void test_tmc_connection(LOGICAL_AXIS_DECL_LC(const bool, true));
 #if ENABLED(TMC_DEBUG)
   #if ENABLED(MONITOR_DRIVER_STATUS)
     void tmc_set_report_interval(const uint16_t update_interval);
+    void tmc_report_poll_stats();
   #endif
   void tmc_report_all(LOGICAL_AXIS_DECL_LC(const bool, true));
   void tmc_get_registers(LOGICAL_AXIS_ARGS_LC(const bool));
@@ -31,12 +31,48 @@
 #include "z_stepper_align.h"
 #include "../module/probe.h"
 
+#if HAS_Z_STEPPER_ALIGN_STEPPER_XY
+  #include "../libs/least_squares_fit.h"
+#endif
+
 ZStepperAlign z_stepper_align;
 
 xy_pos_t ZStepperAlign::xy[NUM_Z_STEPPERS];
 
 #if HAS_Z_STEPPER_ALIGN_STEPPER_XY
+
   xy_pos_t ZStepperAlign::stepper_xy[NUM_Z_STEPPERS];
+
+  /**
+   * Predict the height of the bed (or gantry) at each stepper from the heights
+   * probed at 'count' points, assuming it stays flat. Three or more points are
+   * fitted with a least-squares plane. Two points only define a line, so the
+   * stepper positions are projected onto it. The corrections for the steppers
+   * are then known in one shot. Return false if the points can't be fitted.
+   */
+  bool ZStepperAlign::fit_stepper_z(const uint8_t count, const xy_pos_t probe_xy[], const float probe_z[], const xy_pos_t stepper_xy[], float stepper_z[]) {
+    if (count == 2) {
+      const xy_pos_t dir = probe_xy[1] - probe_xy[0];
+      const float len2 = HYPOT2(dir.x, dir.y);
+      if (len2 < 1e-6f) return false;
+      for (uint8_t i = 0; i < count; ++i) {
+        const xy_pos_t rel = stepper_xy[i] - probe_xy[0];
+        const float t = (rel.x * dir.x + rel.y * dir.y) / len2;
+        stepper_z[i] = probe_z[0] + t * (probe_z[1] - probe_z[0]);
+      }
+      return true;
+    }
+
+    linear_fit_data lfd;
+    incremental_LSF_reset(&lfd);
+    for (uint8_t i = 0; i < count; ++i) incremental_LSF(&lfd, probe_xy[i], probe_z[i]);
+    if (finish_incremental_LSF(&lfd)) return false;
+
+    for (uint8_t i = 0; i < count; ++i)
+      stepper_z[i] = -(lfd.A * stepper_xy[i].x + lfd.B * stepper_xy[i].y + lfd.D);
+    return true;
+  }
+
 #endif
 
 void ZStepperAlign::reset_to_default() {
@@ -112,6 +148,8 @@ void ZStepperAlign::reset_to_default() {
         "four {X,Y} entries (Z, Z2, Z3, and Z4)."
       #elif NUM_Z_STEPPERS == 3
         "three {X,Y} entries (Z, Z2, and Z3)."
+      #else
+        "two {X,Y} entries (Z and Z2)."
       #endif
     );
     COPY(stepper_xy, stepper_xy_init);
@@ -33,6 +33,7 @@ class ZStepperAlign {
 
     #if HAS_Z_STEPPER_ALIGN_STEPPER_XY
       static xy_pos_t stepper_xy[NUM_Z_STEPPERS];
+      static bool fit_stepper_z(const uint8_t count, const xy_pos_t probe_xy[], const float probe_z[], const xy_pos_t stepper_xy[], float stepper_z[]);
     #endif
 
   static void reset_to_default();
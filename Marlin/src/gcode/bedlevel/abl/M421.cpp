@@ -58,7 +58,7 @@ void GcodeSuite::M421() {
               sy = iy >= 0 ? iy : 0, ey = iy >= 0 ? iy : GRID_MAX_POINTS_Y - 1;
       for (uint8_t x = sx; x <= ex; ++x) {
         for (uint8_t y = sy; y <= ey; ++y) {
-          bedlevel.z_values[x][y] = zval + (hasQ ? bedlevel.z_values[x][y] : 0);
+          bedlevel.z_values[x][y] = zval + (hasQ ? float(bedlevel.z_values[x][y]) : 0);
           TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
         }
       }
@@ -37,10 +37,6 @@
   #include "../../feature/bedlevel/bedlevel.h"
 #endif
 
-#if HAS_Z_STEPPER_ALIGN_STEPPER_XY
-  #include "../../libs/least_squares_fit.h"
-#endif
-
 #if ENABLED(BLTOUCH)
   #include "../../feature/bltouch.h"
 #endif
@@ -273,20 +269,22 @@ void GcodeSuite::G34() {
           // the height is calculated from actual print area positions, and not
           // extrapolated motor movements.
 
-          // Compute the least-squares fit for all probed points.
+          // Fit the bed through all probed points.
           // Calculate the Z position of each stepper and store it in z_measured.
           // This allows the actual adjustment logic to be shared by both algorithms.
-          linear_fit_data lfd;
-          incremental_LSF_reset(&lfd);
-          for (uint8_t i = 0; i < NUM_Z_STEPPERS; ++i) {
+          for (uint8_t i = 0; i < NUM_Z_STEPPERS; ++i)
             SERIAL_ECHOLNPGM("PROBEPT_", i, ": ", z_measured[i]);
-            incremental_LSF(&lfd, z_stepper_align.xy[i], z_measured[i]);
+
+          float z_stepper[NUM_Z_STEPPERS];
+          if (!z_stepper_align.fit_stepper_z(NUM_Z_STEPPERS, z_stepper_align.xy, z_measured, z_stepper_align.stepper_xy, z_stepper)) {
+            SERIAL_ECHOLNPGM("?Z_STEPPER_ALIGN_XY points can't be fitted.");
+            err_break = true;
+            break;
           }
-          finish_incremental_LSF(&lfd);
 
           z_measured_min = 100000.0f;
           for (uint8_t i = 0; i < NUM_Z_STEPPERS; ++i) {
-            z_measured[i] = -(lfd.A * z_stepper_align.stepper_xy[i].x + lfd.B * z_stepper_align.stepper_xy[i].y + lfd.D);
+            z_measured[i] = z_stepper[i];
             z_measured_min = _MIN(z_measured_min, z_measured[i]);
           }
 
@@ -39,11 +39,28 @@
   #include "../../feature/probe_temp_comp.h"
 #endif
 
+#if ENABLED(BINARY_MESH)
+  #include "../../feature/binary_report.h"
+
+  // Send the samples as a BINARY_REPORTS frame. See feature/binary_report.h for the format.
+  static void report_samples_binary(const xy_pos_t &pos, const float samples[], const uint8_t count) {
+    uint8_t frame[3 + 13 + 50 * 2 + 2], len = 3;  // Header, position/time/count, up to 50 samples, checksum
+    auto put16 = [&](const uint16_t v) { frame[len++] = v & 0xFF; frame[len++] = v >> 8; };
+    auto put32 = [&](const uint32_t v) { put16(v & 0xFFFF); put16(v >> 16); };
+    put32(uint32_t(int32_t(LROUND(pos.x * 1000))));
+    put32(uint32_t(int32_t(LROUND(pos.y * 1000))));
+    put32(millis());
+    frame[len++] = count;
+    for (uint8_t i = 0; i < count; ++i) put16(mesh_z_to_um(samples[i]));
+    BinaryReport::send_frame(0x50, frame, len - 3);
+  }
+#endif
+
 /**
  * M48: Z probe repeatability measurement function.
  *
  * Usage:
- *   M48 <P#> <X#> <Y#> <V#> <E> <L#> <S> <C#>
+ *   M48 <P#> <X#> <Y#> <V#> <E> <L#> <S> <C#> <B>
  *     P = Number of sampled points (4-50, default 10)
  *     X = Sample X position
  *     Y = Sample Y position
@@ -52,6 +69,7 @@
  *     L = Number of legs of movement before probe
  *     S = Schizoid (Or Star if you prefer)
  *     C = Enable probe temperature compensation (0 or 1, default 1)
+ *     B = Also send the samples as a binary frame (Requires BINARY_MESH)
  *
  * This function requires the machine to be homed before invocation.
  */
@@ -259,6 +277,10 @@ void GcodeSuite::M48() {
     SERIAL_ECHOLNPGM("Finished!");
     dev_report(verbose_level > 0, mean, sigma, min, max, true);
 
+    #if ENABLED(BINARY_MESH)
+      if (parser.seen_test('B')) report_samples_binary(test_position, sample_set, n_samples);
+    #endif
+
     #if HAS_STATUS_MESSAGE
       // Display M48 results in the status bar
       if (MAX_MESSAGE_SIZE <= 20) {
@@ -31,10 +31,17 @@
   millis_t chdk_timeout; // = 0
 #endif
 
-#if defined(PHOTO_POSITION) && PHOTO_DELAY_MS > 0
+#if (defined(PHOTO_POSITION) && PHOTO_DELAY_MS > 0) || ANY(PHOTO_ENCODER_SETTLE, PHOTO_STROBE)
   #include "../../../MarlinCore.h" // for idle()
 #endif
 
+#if ENABLED(PHOTO_STROBE)
+  #include "../../../feature/photo_strobe.h"
+  #if ENABLED(CASE_LIGHT_ENABLE)
+    #include "../../../feature/caselight.h"
+  #endif
+#endif
+
 #ifdef PHOTO_RETRACT_MM
 
   #define _PHOTO_RETRACT_MM (PHOTO_RETRACT_MM + 0)
@@ -96,6 +103,78 @@
   #endif
 #endif
 
+#if ENABLED(PHOTO_STROBE)
+  // Strobe timing in µs from a parameter in ms
+  inline uint32_t strobe_us(const char code, const float ms) { return LROUND(_MAX(parser.floatval(code, ms), 0.0f) * 1000.0f); }
+#endif
+
+inline void trigger_shutter() {
+  // Start timing the strobe first, so the offset doesn't include the IR sequence
+  #if ENABLED(PHOTO_STROBE)
+    photo_strobe.fire(strobe_us('O', PHOTO_STROBE_OFFSET_MS), strobe_us('L', PHOTO_STROBE_WIDTH_MS));
+  #endif
+
+  #if PIN_EXISTS(CHDK)
+
+    OUT_WRITE(CHDK_PIN, HIGH);
+    chdk_timeout = millis() + parser.intval('D', PHOTO_SWITCH_MS);
+
+  #elif HAS_PHOTOGRAPH
+
+    spin_photo_pin();
+    delay(7.33);
+    spin_photo_pin();
+
+  #endif
+}
+
+#if ENABLED(PHOTO_ENCODER_SETTLE)
+
+  #include "../../../feature/encoder_i2c.h"
+  #include "../../../module/planner.h"
+
+  // Only homed axis encoders can tell if the axes are on target
+  inline bool settle_encoder(I2CPositionEncoder &enc) {
+    return enc.get_active() && enc.get_homed() && TERN1(HAS_EXTRUDERS, enc.get_axis() != E_AXIS);
+  }
+
+  /**
+   * Read the encoders every I2CPE_MIN_UPD_TIME_MS for up to 'duration_ms'.
+   *  - hold=false : Return true as soon as all axes are on target and at rest.
+   *  - hold=true  : Return false as soon as any axis moves or leaves its target.
+   */
+  inline bool wait_for_encoders(const millis_t duration_ms, const bool hold) {
+    float last_mm[I2CPE_ENCODER_CNT] = { 0 };
+    LOOP_PE(i) if (settle_encoder(I2CPEM.encoders[i])) last_mm[i] = I2CPEM.encoders[i].get_position_mm();
+
+    millis_t last_ms = millis();
+    const millis_t end_ms = last_ms + duration_ms;
+    for (;;) {
+      const millis_t next_ms = last_ms + I2CPE_MIN_UPD_TIME_MS;
+      while (PENDING(millis(), next_ms)) idle();
+
+      const millis_t ms = millis();
+      const float max_move = PHOTO_SETTLE_SPEED_MM_S * MS_TO_SEC_PRECISE(ms - last_ms);
+      bool at_rest = true;
+      LOOP_PE(i) {
+        I2CPositionEncoder &enc = I2CPEM.encoders[i];
+        if (!settle_encoder(enc)) continue;
+        const float mm = enc.get_position_mm();
+        if (!enc.passes_test(false)
+          || ABS(mm - planner.get_axis_position_mm(enc.get_axis())) > PHOTO_SETTLE_ERROR_MM
+          || ABS(mm - last_mm[i]) > max_move
+        ) at_rest = false;
+        last_mm[i] = mm;
+      }
+      last_ms = ms;
+
+      if (at_rest != hold) return at_rest;
+      if (ELAPSED(ms, end_ms)) return hold;
+    }
+  }
+
+#endif
+
 /**
  * M240: Trigger a camera by...
  *
@@ -121,9 +200,25 @@
  *    P - Delay (ms) after triggering the shutter (Requires PHOTO_SWITCH_MS)
  *    I - Switch trigger position override X
  *    J - Switch trigger position override Y
+ *
+ * PHOTO_ENCODER_SETTLE parameters:
+ *    W - Maximum time (ms) to wait for the axes to settle before skipping the photo
+ *
+ * PHOTO_STROBE parameters:
+ *    O - Delay (ms) from the start of the shutter trigger to the light strobe
+ *    L - Duration (ms) of the light strobe. 0 for no strobe. Fractions of a ms need a hardware
+ *        timer (STM32). With the Temperature ISR fallback shorter than ~5ms is rejected.
  */
 void GcodeSuite::M240() {
 
+  #if ENABLED(PHOTO_STROBE)
+    const uint32_t width_us = strobe_us('L', PHOTO_STROBE_WIDTH_MS);
+    if (width_us && width_us < photo_strobe.min_width_us()) {
+      SERIAL_ECHOLNPGM("?L too short (min ", photo_strobe.min_width_us(), "us).");
+      return;
+    }
+  #endif
+
   #ifdef PHOTO_POSITION
 
     if (homing_needed_error()) return;
@@ -169,19 +264,38 @@ void GcodeSuite::M240() {
 
   #endif
 
-  #if PIN_EXISTS(CHDK)
+  #if ENABLED(PHOTO_ENCODER_SETTLE)
 
-    OUT_WRITE(CHDK_PIN, HIGH);
-    chdk_timeout = millis() + parser.intval('D', PHOTO_SWITCH_MS);
+    planner.synchronize();
 
-  #elif HAS_PHOTOGRAPH
+    const millis_t settle_ms = parser.ulongval('W', PHOTO_SETTLE_TIMEOUT_MS);
+    for (uint8_t retakes = 0; ; ++retakes) {
+      if (!wait_for_encoders(settle_ms, false)) {
+        SERIAL_ECHOLNPGM("M240: Axes not settled. Photo skipped.");
+        break;
+      }
+      trigger_shutter();
+      if (!PHOTO_SETTLE_EXPOSURE_MS || wait_for_encoders(PHOTO_SETTLE_EXPOSURE_MS, true)) break;
+      if (retakes >= PHOTO_SETTLE_RETRIES) {
+        SERIAL_ECHOLNPGM("M240: Axes moved during exposure. Photo blurred.");
+        break;
+      }
+    }
 
-    spin_photo_pin();
-    delay(7.33);
-    spin_photo_pin();
+  #else
+
+    trigger_shutter();
 
   #endif
 
+  #if ALL(PHOTO_STROBE, CASE_LIGHT_ENABLE)
+    // Give the pin back to the case light
+    if (photo_strobe.shares_case_light()) {
+      while (photo_strobe.busy()) idle();
+      caselight.update_enabled();
+    }
+  #endif
+
   #ifdef PHOTO_POSITION
     #if PHOTO_DELAY_MS > 0
       const millis_t timeout = millis() + parser.intval('P', PHOTO_DELAY_MS);
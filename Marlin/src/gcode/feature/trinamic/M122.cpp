@@ -62,8 +62,10 @@ void GcodeSuite::M122() {
 
     if (parser.seen_test('V'))
       tmc_get_registers(LOGICAL_AXIS_ELEM_LC(print_axis));
-    else
+    else {
       tmc_report_all(LOGICAL_AXIS_ELEM_LC(print_axis));
+      TERN_(MONITOR_DRIVER_STATUS, tmc_report_poll_stats());
+    }
   #endif
 
   test_tmc_connection(LOGICAL_AXIS_ELEM_LC(print_axis));
@@ -640,6 +640,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 155: M155(); break;                                  // M155: Set temperature auto-report interval
       #endif
 
+      #if ENABLED(BINARY_REPORTS)
+        case 156: M156(); break;                                  // M156: Set binary status report interval
+      #endif
+
+      #if ENABLED(BINARY_MESH)
+        case 157: M157(); break;                                  // M157: Binary bed mesh export and import
+      #endif
+
       #if ENABLED(PARK_HEAD_ON_PAUSE)
         case 125: M125(); break;                                  // M125: Store current position and move to filament change position
       #endif
@@ -837,7 +845,7 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 305: M305(); break;                                  // M305: Set user thermistor parameters
       #endif
 
-      #if ENABLED(MPCTEMP)
+      #if ANY(MPCTEMP, MPCTEMPBED)
         case 306: M306(); break;                                  // M306: MPC autotune
       #endif
 
@@ -176,6 +176,8 @@
  * M150 - Set Status LED Color as R<red> U<green> B<blue> W<white> P<bright>. Values 0-255. (Requires BLINKM, RGB_LED, RGBW_LED, NEOPIXEL_LED, PCA9533, or PCA9632).
  * M154 - Auto-report position with interval of S<seconds>. (Requires AUTO_REPORT_POSITION)
  * M155 - Auto-report temperatures with interval of S<seconds>. (Requires AUTO_REPORT_TEMPERATURES)
+ * M156 - Binary status reports with interval of S<ms> and sections P<bits>, position telemetry at T<Hz>. (Requires BINARY_REPORTS)
+ * M157 - Send the bed mesh as binary frames, or S save / L load it on the media. (Requires BINARY_MESH)
  * M163 - Set a single proportion for a mixing extruder. (Requires MIXING_EXTRUDER)
  * M164 - Commit the mix and save to a virtual tool (current, or as specified by 'S'). (Requires MIXING_EXTRUDER)
  * M165 - Set the mix for the mixing extruder (and current virtual tool) with parameters ABCDHI. (Requires MIXING_EXTRUDER and DIRECT_MIXING_IN_G1)
@@ -223,7 +225,7 @@
  * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. (Requires PIDTEMP)
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
  * M305 - Set user thermistor parameters R T and P. (Requires TEMP_SENSOR_x 1000)
- * M306 - MPC autotune. (Requires MPCTEMP)
+ * M306 - MPC autotune. (Requires MPCTEMP or MPCTEMPBED)
  * M309 - Set chamber PID parameters P I and D. (Requires PIDTEMPCHAMBER)
  * M350 - Set microstepping mode. (Requires digital microstepping pins.)
  * M351 - Toggle MS1 MS2 pins directly. (Requires digital microstepping pins.)
@@ -863,6 +865,14 @@ private:
     static void M155();
   #endif
 
+  #if ENABLED(BINARY_REPORTS)
+    static void M156();
+  #endif
+
+  #if ENABLED(BINARY_MESH)
+    static void M157();
+  #endif
+
   #if ENABLED(MIXING_EXTRUDER)
     static void M163();
     static void M164();
@@ -1007,7 +1017,7 @@ private:
     static void M305();
   #endif
 
-  #if ENABLED(MPCTEMP)
+  #if ANY(MPCTEMP, MPCTEMPBED)
     static void M306();
     static void M306_report(const bool forReplay=true);
   #endif
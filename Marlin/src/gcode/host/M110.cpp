@@ -28,6 +28,9 @@
  *
  * Parameters:
  *   N<int>  Number to set as last-processed command
+ *   W<int>  With SERIAL_WINDOW_ACK, the number of lines the host will send
+ *           ahead of "ok" replies. W0 for one "ok" per line. The window in
+ *           effect is reported back. Without W the window is reset to 0.
  *
  * Without parameters:
  *   Report the last-processed (not last-received or last-enqueued) command
@@ -35,6 +38,16 @@
  */
 void GcodeSuite::M110() {
 
+  #if ENABLED(SERIAL_WINDOW_ACK)
+    if (parser.seenval('W')) {
+      queue.set_ack_window(_MIN(parser.value_byte(), uint8_t(SERIAL_WINDOW_MAX)));
+      SERIAL_ECHOLNPGM("Window:", queue.get_ack_window());
+      if (!parser.seen('N')) return;
+    }
+    else
+      queue.set_ack_window(0);  // A host that doesn't know the window expects one "ok" per line
+  #endif
+
   if (parser.seenval('N'))
     queue.set_current_line_number(parser.value_long());
   else
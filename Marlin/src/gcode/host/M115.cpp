@@ -130,6 +130,9 @@ void GcodeSuite::M115() {
     // SERIAL_XON_XOFF
     cap_line(F("SERIAL_XON_XOFF"), ENABLED(SERIAL_XON_XOFF));
 
+    // SERIAL_WINDOW_ACK (M110 W)
+    cap_line(F("SERIAL_WINDOW"), ENABLED(SERIAL_WINDOW_ACK));
+
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(F("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER)); // TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
@@ -145,6 +148,12 @@ void GcodeSuite::M115() {
     // AUTOREPORT_TEMP (M155)
     cap_line(F("AUTOREPORT_TEMP"), ENABLED(AUTO_REPORT_TEMPERATURES));
 
+    // BINARY_REPORTS (M156)
+    cap_line(F("BINARY_REPORTS"), ENABLED(BINARY_REPORTS));
+
+    // BINARY_MESH (M157)
+    cap_line(F("BINARY_MESH"), ENABLED(BINARY_MESH));
+
     // PROGRESS (M530 S L, M531 <file>, M532 X L)
     cap_line(F("PROGRESS"), false);
 
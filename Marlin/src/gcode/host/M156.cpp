@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(BINARY_REPORTS)
+
+#include "../gcode.h"
+#include "../queue.h"
+#include "../../feature/binary_report.h"
+
+/**
+ * M156: Binary status reports. See feature/binary_report.h for the frame format.
+ *
+ *  S<ms>    Report interval in milliseconds, 0 to stop. Intervals under 10ms are raised to 10ms.
+ *  P<bits>  Sections to include: 1=Temperatures 2=Position 4=Buffers 8=Endstops. Default all.
+ *  T<Hz>    Stream stepper positions sampled at this rate, 0 to stop. (Requires POSITION_TELEMETRY)
+ *
+ * Without 'S' or 'T' send a single report now.
+ */
+void GcodeSuite::M156() {
+
+  if (parser.seenval('P'))
+    binary_report.sections = parser.value_byte() & BinaryReport::REPORT_ALL;
+
+  const bool seenS = parser.seenval('S'), seenT = TERN0(POSITION_TELEMETRY, parser.seenval('T'));
+
+  // Only the host that asked for binary reports should receive them
+  if (seenS || seenT)
+    TERN_(HAS_MULTI_SERIAL, binary_report.report_port_mask = SerialMask::from(queue.ring_buffer.command_port()));
+
+  if (seenS) binary_report.set_interval(parser.ushortval('S'));
+
+  #if ENABLED(POSITION_TELEMETRY)
+    if (seenT) position_telemetry.set_rate(parser.ushortval('T'));
+  #endif
+
+  if (!seenS && !seenT) binary_report.report();
+
+}
+
+#endif // BINARY_REPORTS
@@ -0,0 +1,205 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(BINARY_MESH)
+
+#include "../gcode.h"
+#include "../../feature/binary_report.h"
+#include "../../feature/bedlevel/bedlevel.h"
+#include "../../module/planner.h"
+#include "../../module/temperature.h"
+
+#if HAS_MEDIA
+  #include "../../sd/cardreader.h"
+#endif
+
+#if ENABLED(EXTENSIBLE_UI)
+  #include "../../lcd/extui/ui_api.h"
+#endif
+
+// See feature/binary_report.h for the frame format
+#define MESH_VERSION      1
+#define MESH_HEADER_TYPE  0x4D
+#define MESH_ROW_TYPE     0x6D
+#define MESH_HEADER_LEN   28
+#define MESH_ROW_LEN      (2 + (GRID_MAX_POINTS_X) * 2)
+
+typedef uint8_t mesh_frame_t[3 + _MAX(MESH_HEADER_LEN, MESH_ROW_LEN) + 2];
+
+static uint16_t get16(const uint8_t * const p) { return p[0] | (uint16_t(p[1]) << 8); }
+static uint32_t get32(const uint8_t * const p) { return get16(p) | (uint32_t(get16(p + 2)) << 16); }
+
+/**
+ * Send the mesh frames to the serial port or write them to the open file
+ */
+static bool export_mesh(const bool to_file) {
+  mesh_frame_t frame;
+  uint8_t len;
+
+  auto put8  = [&](const uint8_t v) { frame[len++] = v; };
+  auto put16 = [&](const uint16_t v) { put8(v & 0xFF); put8(v >> 8); };
+  auto put32 = [&](const uint32_t v) { put16(v & 0xFFFF); put16(v >> 16); };
+  auto put_um = [&](const_float_t mm) { put32(uint32_t(int32_t(LROUND(mm * 1000)))); };
+
+  uint16_t clamped = 0;
+
+  auto emit = [&](const uint8_t type) {
+    #if HAS_MEDIA
+      if (to_file) {
+        const uint8_t flen = BinaryReport::seal_frame(type, frame, len - 3);
+        return card.write(frame, flen) == flen;
+      }
+    #endif
+    BinaryReport::send_frame(type, frame, len - 3);
+    return true;
+  };
+
+  len = 3;
+  put8(MESH_VERSION);
+  put8(planner.leveling_active | (leveling_is_valid() ? 2 : 0));
+  put8(GRID_MAX_POINTS_X);
+  put8(GRID_MAX_POINTS_Y);
+  put_um(bedlevel.get_mesh_x(0));
+  put_um(bedlevel.get_mesh_y(0));
+  put_um(bedlevel.get_mesh_x(1) - bedlevel.get_mesh_x(0));
+  put_um(bedlevel.get_mesh_y(1) - bedlevel.get_mesh_y(0));
+  put16(TERN(HAS_HOTEND, int16_t(LROUND(thermalManager.degHotend(0) * 10)), INT16_MIN));
+  put16(TERN(HAS_HEATED_BED, int16_t(LROUND(thermalManager.degBed() * 10)), INT16_MIN));
+  put32(millis());
+  if (!emit(MESH_HEADER_TYPE)) return false;
+
+  for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; ++y) {
+    len = 3;
+    put8(y);
+    put8(GRID_MAX_POINTS_X);
+    for (uint8_t x = 0; x < GRID_MAX_POINTS_X; ++x) {
+      const float z = bedlevel.z_values[x][y];
+      if (ABS(z) > MESH_UM_MAX_Z) ++clamped;
+      put16(mesh_z_to_um(z));
+    }
+    if (!emit(MESH_ROW_TYPE)) return false;
+  }
+
+  if (clamped) SERIAL_WARN_MSG("Mesh Z clamped to +/-32.766mm at ", clamped, " points");
+
+  return true;
+}
+
+#if HAS_MEDIA
+
+  // Read the next frame from the open file and verify its type, size and checksum
+  static bool read_frame(mesh_frame_t &frame, const uint8_t type, const uint8_t payload_len) {
+    if (card.read(frame, 3) != 3 || frame[0] != 0xB5 || frame[1] != type || frame[2] != payload_len) return false;
+    if (card.read(frame + 3, payload_len + 2) != payload_len + 2) return false;
+    const uint16_t sum = BinaryReport::checksum(frame);
+    return frame[payload_len + 3] == (sum & 0xFF) && frame[payload_len + 4] == (sum >> 8);
+  }
+
+  /**
+   * Check the whole file and, with 'apply', replace the mesh with its contents.
+   * The grid size must match. Only bilinear leveling can take a different grid position.
+   */
+  static bool import_mesh(const bool apply) {
+    mesh_frame_t frame;
+    const uint8_t * const data = frame + 3;
+
+    card.setIndex(0);
+    if (!read_frame(frame, MESH_HEADER_TYPE, MESH_HEADER_LEN)) return false;
+    if (data[0] != MESH_VERSION || data[2] != GRID_MAX_POINTS_X || data[3] != GRID_MAX_POINTS_Y) return false;
+
+    const xy_pos_t start = { int32_t(get32(data + 4)) * 0.001f, int32_t(get32(data + 8)) * 0.001f },
+                   spacing = { int32_t(get32(data + 12)) * 0.001f, int32_t(get32(data + 16)) * 0.001f };
+    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+      if (spacing.x <= 0 || spacing.y <= 0) return false;
+      if (apply) bedlevel.set_grid(spacing, start);
+    #else
+      // Other mesh types have a fixed grid. Allow for rounding to whole µm.
+      auto differ = [](const_float_t a, const_float_t b) { return !WITHIN(a - b, -0.002f, 0.002f); };
+      if (differ(start.x, bedlevel.get_mesh_x(0)) || differ(start.y, bedlevel.get_mesh_y(0))
+        || differ(spacing.x, bedlevel.get_mesh_x(1) - bedlevel.get_mesh_x(0))
+        || differ(spacing.y, bedlevel.get_mesh_y(1) - bedlevel.get_mesh_y(0))
+      ) return false;
+    #endif
+
+    for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; ++y) {
+      if (!read_frame(frame, MESH_ROW_TYPE, MESH_ROW_LEN) || data[0] != y || data[1] != GRID_MAX_POINTS_X) return false;
+      if (apply) for (uint8_t x = 0; x < GRID_MAX_POINTS_X; ++x) {
+        bedlevel.z_values[x][y] = mesh_um_to_z(int16_t(get16(data + 2 + x * 2)));
+        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
+      }
+    }
+
+    TERN_(AUTO_BED_LEVELING_BILINEAR, if (apply) bedlevel.refresh_bed_level());
+    return true;
+  }
+
+#endif // HAS_MEDIA
+
+/**
+ * M157: Binary bed mesh export and import. See feature/binary_report.h for the frame format.
+ *
+ *  S  Save the mesh to BINARY_MESH_FILE on the media
+ *  L  Load the mesh from BINARY_MESH_FILE. The file is checked completely before the mesh is changed.
+ *
+ * Without 'S' or 'L' send the mesh to the host.
+ */
+void GcodeSuite::M157() {
+
+  #if HAS_MEDIA
+    const bool save = DISABLED(SDCARD_READONLY) && parser.seen_test('S'),
+               load = !save && parser.seen_test('L');
+
+    if (save || load) {
+      if (card.isFileOpen()) { SERIAL_ERROR_MSG("Media file already open"); return; }
+      if (!card.isMounted()) card.mount();
+
+      bool ok;
+      if (save) {
+        card.openFileWrite(BINARY_MESH_FILE);
+        if (!card.isFileOpen()) return;
+        ok = export_mesh(true);
+        card.closefile();
+        if (!ok) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+      }
+      else {
+        card.openFileRead(BINARY_MESH_FILE);
+        if (!card.isFileOpen()) return;
+        ok = import_mesh(false);
+        if (ok) {
+          TEMPORARY_BED_LEVELING_STATE(false);
+          import_mesh(true);
+        }
+        card.closefile();
+        if (!ok) SERIAL_ERROR_MSG("Invalid mesh file");
+      }
+      if (ok) SERIAL_ECHOLNPGM("Mesh ", save ? F("saved to ") : F("loaded from "), BINARY_MESH_FILE);
+      return;
+    }
+  #endif
+
+  export_mesh(false);
+
+}
+
+#endif // BINARY_MESH
@@ -112,12 +112,42 @@ void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
 bool GCodeQueue::RingBuffer::enqueue(const char *cmd, const bool skip_ok/*=true*/
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
+  if (*cmd == ';' || length >= BUFSIZE || !displace_serial_line()) return false;
   strcpy(commands[index_w].buffer, cmd);
   commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
   return true;
 }
 
+#if ENABLED(SERIAL_DIRECT_QUEUE)
+
+  /**
+   * Serial input accumulates in the free slot at index_w. Before another
+   * source writes to that slot move the partial line up to the next slot,
+   * where it will be at index_w again once the other command is committed.
+   * Return false if there's no free slot to move it into.
+   */
+  bool GCodeQueue::RingBuffer::displace_serial_line() {
+    const int count = serial_state[0].count;
+    if (!count) return true;
+    if (full(2)) return false;
+    const uint8_t next = index_w + 1 < BUFSIZE ? index_w + 1 : 0;
+    memcpy(commands[next].buffer, commands[index_w].buffer, count);
+    return true;
+  }
+
+  /**
+   * Move a displaced partial line back to index_w
+   * if the other source didn't commit a command.
+   */
+  void GCodeQueue::RingBuffer::restore_serial_line() {
+    const int count = serial_state[0].count;
+    if (!count) return;
+    const uint8_t next = index_w + 1 < BUFSIZE ? index_w + 1 : 0;
+    memcpy(commands[index_w].buffer, commands[next].buffer, count);
+  }
+
+#endif
+
 /**
  * Enqueue with Serial Echo
  * Return true if the command was consumed
@@ -187,12 +217,22 @@ bool GCodeQueue::process_injected_command() {
   return true;
 }
 
+/**
+ * With SERIAL_DIRECT_QUEUE a partial host line may hold the last free slot.
+ * idle() doesn't read serial input, so keep reading here to let that line
+ * complete. Otherwise the command could wait forever for the slot.
+ */
+void GCodeQueue::wait_for_enqueue() {
+  TERN_(SERIAL_DIRECT_QUEUE, get_serial_commands());
+  idle();
+}
+
 /**
  * Enqueue and return only when commands are actually enqueued.
  * Never call this from a G-code handler!
  */
-void GCodeQueue::enqueue_one_now(const char * const cmd) { while (!enqueue_one(cmd)) idle(); }
-void GCodeQueue::enqueue_one_now(FSTR_P const fcmd) { while (!enqueue_one(fcmd)) idle(); }
+void GCodeQueue::enqueue_one_now(const char * const cmd) { while (!enqueue_one(cmd)) wait_for_enqueue(); }
+void GCodeQueue::enqueue_one_now(FSTR_P const fcmd) { while (!enqueue_one(fcmd)) wait_for_enqueue(); }
 
 /**
  * Attempt to enqueue a single G-code command
@@ -236,6 +276,10 @@ void GCodeQueue::enqueue_now_P(PGM_P const pgcode) {
  *   N<int>  Line number of the command, if any
  *   P<int>  Planner space remaining
  *   B<int>  Block queue space remaining
+ *
+ * With SERIAL_WINDOW_ACK and a window set by M110 W the "ok" is
+ * held back while more lines from the same host are queued, up to
+ * half the window. The line number acknowledges all prior lines.
  */
 void GCodeQueue::RingBuffer::ok_to_send() {
   #if NO_TIMEOUTS > 0
@@ -249,15 +293,33 @@ void GCodeQueue::RingBuffer::ok_to_send() {
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
   if (command.skip_ok) return;
+
+  #if ENABLED(SERIAL_WINDOW_ACK)
+    SerialState &serial = serial_state[command_port().index];
+    if (serial.ack_window) {
+      // Defer only if the next command will also send an "ok" to this host
+      const CommandLine &next = commands[index_r + 1 < BUFSIZE ? index_r + 1 : 0];
+      if (length > 1 && !next.skip_ok && TERN1(HAS_MULTI_SERIAL, next.port.index == command.port.index)
+        && ++serial.acks_deferred < (serial.ack_window + 1) / 2
+      ) return;
+      serial.acks_deferred = 0;
+    }
+    const bool send_line_no = ENABLED(ADVANCED_OK) || serial.ack_window;
+  #else
+    constexpr bool send_line_no = ENABLED(ADVANCED_OK);
+  #endif
+
   SERIAL_ECHOPGM(STR_OK);
-  #if ENABLED(ADVANCED_OK)
+  if (send_line_no) {
     char* p = command.buffer;
     if (*p == 'N') {
       SERIAL_CHAR(' ', *p++);
       while (NUMERIC_SIGNED(*p))
         SERIAL_CHAR(*p++);
     }
-    SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - length);
+  }
+  #if ENABLED(ADVANCED_OK)
+    SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, free_slots());
   #endif
   SERIAL_EOL();
 }
@@ -324,6 +386,12 @@ void GCodeQueue::gcode_line_error(FSTR_P const ferr, const serial_index_t serial
   while (read_serial(serial_ind) != -1) { /* nada */ } // Clear out the RX buffer. Why don't use flush here ?
   flush_and_request_resend(serial_ind);
   serial_state[serial_ind.index].count = 0;
+  #if ENABLED(SERIAL_WINDOW_ACK)
+    // A windowed host may already have sent more lines. Ignore them until the resend.
+    // The resent line restarts the count of deferred "ok" replies.
+    serial_state[serial_ind.index].resend_requested = serial_state[serial_ind.index].ack_window;
+    serial_state[serial_ind.index].acks_deferred = 0;
+  #endif
 }
 
 FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", but not "M290", etc
@@ -441,6 +509,14 @@ void GCodeQueue::get_serial_commands() {
       // Check if the queue is full and exit if it is.
       if (ring_buffer.full()) return;
 
+      #if ENABLED(SERIAL_WINDOW_ACK)
+        // A new host on this port may not know about the window
+        if (serial_state[p].ack_window) {
+          PORT_REDIRECT(SERIAL_PORTMASK(p));
+          if (!SERIAL_IMPL.connected()) set_ack_window(p, 0);
+        }
+      #endif
+
       // No data for this port ? Skip it
       if (!serial_data_available(p)) continue;
 
@@ -461,13 +537,16 @@ void GCodeQueue::get_serial_commands() {
       const char serial_char = (char)c;
       SerialState &serial = serial_state[p];
 
+      // The line accumulator, which may be the free command queue slot
+      char (&line_buffer)[MAX_CMD_SIZE] = TERN(SERIAL_DIRECT_QUEUE, ring_buffer.commands[ring_buffer.index_w].buffer, serial.line_buffer);
+
       if (ISEOL(serial_char)) {
 
         // Reset our state, continue if the line was empty
-        if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
+        if (process_line_done(serial.input_state, line_buffer, serial.count))
           continue;
 
-        char* command = serial.line_buffer;
+        char* command = line_buffer;
 
         while (*command == ' ') command++;                   // Skip leading spaces
         char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
@@ -487,6 +566,8 @@ void GCodeQueue::get_serial_commands() {
           if (gcode_N != serial.last_N + 1 && !M110) {
             // A request-for-resend line was already in transit so we got two - oops!
             if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) continue;
+            // Lines sent ahead within the window before the resend request
+            if (TERN0(SERIAL_WINDOW_ACK, serial.resend_requested && gcode_N > serial.last_N)) continue;
             // A corrupted line or too high, indicating a lost line
             gcode_line_error(F(STR_ERR_LINE_NO), p);
             break;
@@ -507,6 +588,7 @@ void GCodeQueue::get_serial_commands() {
           }
 
           serial.last_N = gcode_N;
+          TERN_(SERIAL_WINDOW_ACK, serial.resend_requested = false);
         }
         #if HAS_MEDIA
           // Pronterface "M29" and "M29 " has no line number
@@ -549,10 +631,14 @@ void GCodeQueue::get_serial_commands() {
         #endif
 
         // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        #if ENABLED(SERIAL_DIRECT_QUEUE)
+          ring_buffer.commit_command(false);
+        #else
+          ring_buffer.enqueue(line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        #endif
       }
       else
-        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
+        process_stream_char(serial_char, serial.input_state, line_buffer, serial.count);
 
     } // NUM_SERIAL loop
   } // queue has space, serial has data
@@ -573,7 +659,14 @@ void GCodeQueue::get_serial_commands() {
     if (!card.isStillFetching()) return;
 
     int sd_count = 0;
+    bool displaced = false;
     while (!ring_buffer.full() && !card.eof()) {
+      // Move any partial serial line out of the way once, before starting a new line
+      if (!displaced) {
+        if (!ring_buffer.displace_serial_line()) break;
+        displaced = true;
+      }
+
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
@@ -603,6 +696,10 @@ void GCodeQueue::get_serial_commands() {
           // Prime Power-Loss Recovery for the NEXT commit_command
           TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
         }
+        else
+          ring_buffer.restore_serial_line();  // Nothing committed. Put back a displaced serial line.
+
+        displaced = false;
 
         if (card.eof()) card.fileHasFinished();         // Handle end of file reached
       }
@@ -710,7 +807,7 @@ void GCodeQueue::advance() {
   void GCodeQueue::report_buffer_statistics() {
     SERIAL_ECHOLNPGM("D576"
       " P:", planner.moves_free(),         " ", planner_buffer_underruns, " (", max_planner_buffer_empty_duration, ")"
-      " B:", BUFSIZE - ring_buffer.length, " ", command_buffer_underruns, " (", max_command_buffer_empty_duration, ")"
+      " B:", ring_buffer.free_slots(), " ", command_buffer_underruns, " (", max_command_buffer_empty_duration, ")"
     );
     command_buffer_underruns = planner_buffer_underruns = 0;
     max_command_buffer_empty_duration = max_planner_buffer_empty_duration = 0;
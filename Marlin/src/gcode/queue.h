@@ -41,8 +41,15 @@ public:
      */
     long last_N;
     int count;                      //!< Number of characters read in the current line of serial input
-    char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
+    #if DISABLED(SERIAL_DIRECT_QUEUE)
+      char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
+    #endif
     uint8_t input_state;            //!< The input state
+    #if ENABLED(SERIAL_WINDOW_ACK)
+      uint8_t ack_window,           //!< Lines the host may send ahead (M110 W). 0 for one "ok" per line.
+              acks_deferred;        //!< Number of "ok" replies held back for the next cumulative "ok"
+      bool resend_requested;        //!< Drop in-flight lines until the requested line arrives
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -75,7 +82,14 @@ public:
 
     inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, commands[index_r].port); }
 
-    inline void clear() { length = index_r = index_w = 0; }
+    inline void clear() {
+      length = 0;
+      #if ENABLED(SERIAL_DIRECT_QUEUE)
+        index_r = index_w;          // Keep a partial serial line in place
+      #else
+        index_r = index_w = 0;
+      #endif
+    }
 
     void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
     inline void advance_w() { advance_pos(index_w, 1); }
@@ -89,10 +103,21 @@ public:
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind=serial_index_t())
     );
 
+    #if ENABLED(SERIAL_DIRECT_QUEUE)
+      bool displace_serial_line();
+      void restore_serial_line();
+    #else
+      static bool displace_serial_line() { return true; }
+      static void restore_serial_line() {}
+    #endif
+
     void ok_to_send();
 
     inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
 
+    // Slots free for new commands. A slot holding a partial serial line is not free.
+    inline uint8_t free_slots() const { return BUFSIZE - length - TERN0(SERIAL_DIRECT_QUEUE, serial_state[0].count != 0); }
+
     inline bool occupied() const { return length != 0; }
 
     inline bool empty() const { return !occupied(); }
@@ -219,6 +244,20 @@ public:
    */
   static long get_current_line_number() { return serial_state[ring_buffer.command_port().index].last_N; }
 
+  #if ENABLED(SERIAL_WINDOW_ACK)
+    /**
+     * Set the flow control window for the serial port of the current command
+     */
+    static void set_ack_window(const uint8_t w) { set_ack_window(ring_buffer.command_port(), w); }
+    static void set_ack_window(const serial_index_t serial_ind, const uint8_t w) {
+      SerialState &serial = serial_state[serial_ind.index];
+      serial.ack_window = w;
+      serial.acks_deferred = 0;
+      serial.resend_requested = false;
+    }
+    static uint8_t get_ack_window() { return serial_state[ring_buffer.command_port().index].ack_window; }
+  #endif
+
   #if ENABLED(BUFFER_MONITORING)
 
     private:
@@ -263,6 +302,9 @@ private:
 
   static void get_serial_commands();
 
+  // Wait in enqueue_one_now() for the queue to accept a command
+  static void wait_for_enqueue();
+
   #if HAS_MEDIA
     static void get_sdcard_commands();
   #endif
@@ -22,7 +22,7 @@
 
 #include "../../inc/MarlinConfig.h"
 
-#if ENABLED(MPCTEMP)
+#if ANY(MPCTEMP, MPCTEMPBED)
 
 #include "../gcode.h"
 #include "../../lcd/marlinui.h"
@@ -32,6 +32,7 @@
  * M306: MPC settings and autotune
  *
  *  E<extruder>               Extruder index. (Default: Active Extruder)
+ *                            With MPCTEMPBED use E-1 for the bed.
  *
  * Set MPC values manually for the specified or active extruder:
  *  A<watts/kelvin>           Ambient heat transfer coefficient (no fan).
@@ -46,9 +47,40 @@
  *                            S0 : Autotuning method AUTO (default)
  *                            S1 : Autotuning method DIFFERENTIAL
  *                            S2 : Autotuning method ASYMPTOTIC
+ *
+ *  With MPC_BED_AUTOTUNE:
+ *  E-1 T                     Autotune the bed.
+ *
+ *  The bed model uses only A, C, P, and R.
  */
 
 void GcodeSuite::M306() {
+  #if ENABLED(MPCTEMPBED)
+    if (parser.intval('E') < 0) {
+      #if ENABLED(MPC_BED_AUTOTUNE)
+        if (parser.seen_test('T')) {
+          LCD_MESSAGE(MSG_MPC_AUTOTUNE);
+          thermalManager.MPC_autotune_bed();
+          ui.reset_status();
+          return;
+        }
+      #endif
+      if (parser.seen("ACPR")) {
+        MPCBed_t &mpc = thermalManager.temp_bed.mpc;
+        if (parser.seenval('P')) mpc.heater_power = parser.value_float();
+        if (parser.seenval('C')) mpc.block_heat_capacity = parser.value_float();
+        if (parser.seenval('R')) mpc.sensor_responsiveness = parser.value_float();
+        if (parser.seenval('A')) mpc.ambient_xfer_coeff = parser.value_float();
+        thermalManager.temp_bed.update_model();
+        return;
+      }
+      M306_report(true);
+      return;
+    }
+  #endif
+
+  #if ENABLED(MPCTEMP)
+
   const uint8_t e = TERN0(HAS_MULTI_EXTRUDER, parser.intval('E', active_extruder));
   if (e >= (EXTRUDERS)) {
     SERIAL_ECHOLNPGM("?(E)xtruder index out of range (0-", (EXTRUDERS) - 1, ").");
@@ -84,6 +116,8 @@ void GcodeSuite::M306() {
     return;
   }
 
+  #endif // MPCTEMP
+
   M306_report(true);
 }
 
@@ -91,6 +125,19 @@ void GcodeSuite::M306_report(const bool forReplay/*=true*/) {
   TERN_(MARLIN_SMALL_BUILD, return);
 
   report_heading(forReplay, F("Model predictive control"));
+
+  #if ENABLED(MPCTEMPBED)
+    report_echo_start(forReplay);
+    const MPCBed_t &bmpc = thermalManager.temp_bed.mpc;
+    SERIAL_ECHOLNPGM("  M306 E-1"
+                         " P", p_float_t(bmpc.heater_power, 2),
+                         " C", p_float_t(bmpc.block_heat_capacity, 2),
+                         " R", p_float_t(bmpc.sensor_responsiveness, 4),
+                         " A", p_float_t(bmpc.ambient_xfer_coeff, 4)
+    );
+  #endif
+
+  #if ENABLED(MPCTEMP)
   HOTEND_LOOP() {
     report_echo_start(forReplay);
     MPC_t &mpc = thermalManager.temp_hotend[e].mpc;
@@ -105,6 +152,7 @@ void GcodeSuite::M306_report(const bool forReplay/*=true*/) {
     #endif
     SERIAL_ECHOLNPGM(" H", p_float_t(mpc.filament_heat_capacity_permm, 4));
   }
+  #endif
 }
 
-#endif // MPCTEMP
+#endif // MPCTEMP || MPCTEMPBED
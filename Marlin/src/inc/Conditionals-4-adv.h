@@ -1459,6 +1459,31 @@
   #define CASELIGHT_USES_BRIGHTNESS 1
 #endif
 
+// Binary file transfer defaults
+#if ENABLED(BINARY_FILE_TRANSFER)
+  #ifndef BINARY_STREAM_WINDOW_BITS
+    #define BINARY_STREAM_WINDOW_BITS 8
+  #endif
+  #ifndef BINARY_STREAM_LOOKAHEAD_BITS
+    #define BINARY_STREAM_LOOKAHEAD_BITS 4
+  #endif
+  #ifndef BINARY_STREAM_WRITE_BUFFERS
+    #define BINARY_STREAM_WRITE_BUFFERS 2
+  #endif
+#endif
+
+#if ENABLED(POSITION_TELEMETRY) && !defined(POSITION_TELEMETRY_BUFFER)
+  #define POSITION_TELEMETRY_BUFFER 16
+#endif
+#if ENABLED(BINARY_MESH) && !defined(BINARY_MESH_FILE)
+  #define BINARY_MESH_FILE "MESH.BIN"
+#endif
+
+// A quantized mesh is already stored in the optimized format
+#if ALL(QUANTIZED_MESH, OPTIMIZED_MESH_STORAGE)
+  #undef OPTIMIZED_MESH_STORAGE
+#endif
+
 // Flag whether least_squares_fit.cpp is used
 #if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, HAS_Z_STEPPER_ALIGN_STEPPER_XY)
   #define NEED_LSF 1
@@ -2621,6 +2621,8 @@
   #define BED_MAX_TARGET ((BED_MAXTEMP) - (BED_OVERSHOOT))
 #else
   #undef PIDTEMPBED
+  #undef MPCTEMPBED
+  #undef MPC_BED_AUTOTUNE
   #undef PREHEAT_BEFORE_LEVELING
 #endif
 
@@ -2763,7 +2765,7 @@
 #if !HAS_TEMP_SENSOR
   #undef AUTO_REPORT_TEMPERATURES
 #endif
-#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS)
+#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS, BINARY_REPORTS)
   #define HAS_AUTO_REPORTING 1
 #endif
 
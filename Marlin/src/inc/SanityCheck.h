@@ -413,6 +413,17 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "LIGHTWEIGHT_UI requires a U8GLIB_ST7920-based display."
 #endif
 
+/**
+ * Skip sending unchanged display pages
+ */
+#if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+  #if !HAS_MARLINUI_U8GLIB
+    #error "DOGM_SKIP_UNCHANGED_PAGES requires a U8glib-based graphical display."
+  #elif TFT_SCALED_DOGLCD
+    #error "DOGM_SKIP_UNCHANGED_PAGES is not compatible with TFT_CLASSIC_UI."
+  #endif
+#endif
+
 /**
  * SD Card Settings
  */
@@ -1043,9 +1054,49 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+/**
+ * Serial input directly into the command queue
+ */
+#if ENABLED(SERIAL_DIRECT_QUEUE)
+  #if HAS_MULTI_SERIAL
+    #error "SERIAL_DIRECT_QUEUE requires a single serial port."
+  #elif ENABLED(BINARY_FILE_TRANSFER)
+    #error "SERIAL_DIRECT_QUEUE is not compatible with BINARY_FILE_TRANSFER."
+  #endif
+#endif
+
+/**
+ * Sliding-window flow control
+ */
+#if ENABLED(SERIAL_WINDOW_ACK)
+  #ifdef RX_BUFFER_SIZE
+    #define _SERIAL_WINDOW_RX_LINES ((RX_BUFFER_SIZE) / (MAX_CMD_SIZE))
+  #else
+    #define _SERIAL_WINDOW_RX_LINES 0
+  #endif
+  static_assert(WITHIN(SERIAL_WINDOW_MAX, 1, 255), "SERIAL_WINDOW_MAX must be from 1 to 255.");
+  static_assert(SERIAL_WINDOW_MAX <= (BUFSIZE) + _SERIAL_WINDOW_RX_LINES, "SERIAL_WINDOW_MAX must not exceed BUFSIZE + RX_BUFFER_SIZE / MAX_CMD_SIZE lines.");
+  #undef _SERIAL_WINDOW_RX_LINES
+#endif
+
+/**
+ * Batched temperature ADC sampling
+ */
+#if ENABLED(TEMP_ADC_BATCH_SAMPLING) && DISABLED(HAL_ADC_CONTINUOUS)
+  #error "TEMP_ADC_BATCH_SAMPLING requires a HAL with continuous ADC conversion (e.g., STM32F1, LPC176x)."
+#endif
+
 /**
  * Bed Heating Options - PID vs Limit Switching
  */
+#if ALL(PIDTEMPBED, MPCTEMPBED)
+  #error "Only enable PIDTEMPBED or MPCTEMPBED, but not both."
+#elif ALL(MPCTEMPBED, BED_LIMIT_SWITCHING)
+  #error "To use BED_LIMIT_SWITCHING you must disable MPCTEMPBED."
+#elif ALL(MPCTEMPBED, PELTIER_BED)
+  #error "PELTIER_BED is not compatible with MPCTEMPBED."
+#endif
+
 #if ALL(PIDTEMPBED, BED_LIMIT_SWITCHING)
   #error "To use BED_LIMIT_SWITCHING you must disable PIDTEMPBED."
 #endif
@@ -1693,6 +1744,14 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
 #if ALL(HAS_MESH, CLASSIC_JERK)
   static_assert(DEFAULT_ZJERK > 0.1, "Low DEFAULT_ZJERK values are incompatible with mesh-based leveling.");
 #endif
+#if ENABLED(QUANTIZED_MESH)
+  #if NONE(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    #error "QUANTIZED_MESH requires AUTO_BED_LEVELING_BILINEAR or AUTO_BED_LEVELING_UBL."
+  #elif ANY(MESH_EDIT_MENU, DWIN_LCD_PROUI, DWIN_CREALITY_LCD_JYERSUI, EXTENSIBLE_UI)
+    #error "QUANTIZED_MESH is not compatible with MESH_EDIT_MENU, DWIN_LCD_PROUI, DWIN_CREALITY_LCD_JYERSUI, or EXTENSIBLE_UI."
+  #endif
+#endif
+
 #if HAS_MESH && DGUS_LCD_UI_IA_CREALITY && GRID_MAX_POINTS > 25
   #error "DGUS_LCD_UI IA_CREALITY requires a mesh with no more than 25 points as defined by GRID_MAX_POINTS_X/Y."
 #endif
@@ -2716,7 +2775,13 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     #error "NEOPIXEL2_SEPARATE requires NEOPIXEL2_TYPE, NEOPIXEL2_PIN and NEOPIXEL2_PIXELS."
   #elif ENABLED(NEO2_COLOR_PRESETS) && DISABLED(NEOPIXEL2_SEPARATE)
     #error "NEO2_COLOR_PRESETS requires NEOPIXEL2_SEPARATE to be enabled."
+  #elif ENABLED(NEOPIXEL_DMA) && (DISABLED(HAL_STM32) || NONE(STM32F1xx, STM32F4xx))
+    #error "NEOPIXEL_DMA is only available for STM32F1 and STM32F4 and requires HAL/STM32."
+  #elif ENABLED(NEOPIXEL_DMA) && PIN_EXISTS(NEOPIXEL2)
+    #error "NEOPIXEL_DMA only supports a single strip on NEOPIXEL_PIN."
   #endif
+#elif ENABLED(NEOPIXEL_DMA)
+  #error "NEOPIXEL_DMA requires NEOPIXEL_LED."
 #endif
 
 #if DISABLED(NO_COMPILE_TIME_PWM)
@@ -2773,6 +2838,9 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     + ENABLED(IIC_BL24CXX_EEPROM)
     #error "Please select only one method of EEPROM Persistent Storage."
   #endif
+  #if ENABLED(FLASH_EEPROM_JOURNAL) && !ALL(FLASH_EEPROM_EMULATION, FLASH_EEPROM_LEVELING)
+    #error "FLASH_EEPROM_JOURNAL requires FLASH_EEPROM_EMULATION with FLASH_EEPROM_LEVELING (STM32F4/H7)."
+  #endif
 #endif
 
 /**
@@ -2928,6 +2996,26 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "GRAPHICAL_TFT_UPSCALE must be between 2 and 8."
 #endif
 
+#if ENABLED(TFT_QUEUE_DMA_CHAINING)
+  #if DISABLED(TFT_COLOR_UI)
+    #error "TFT_QUEUE_DMA_CHAINING requires TFT_COLOR_UI."
+  #elif DISABLED(HAL_STM32) || NONE(HAS_FSMC_TFT, HAS_SPI_TFT)
+    #error "TFT_QUEUE_DMA_CHAINING requires an FSMC or SPI TFT on STM32 (HAL/STM32)."
+  #elif ENABLED(TFT_SHARED_IO)
+    #error "TFT_QUEUE_DMA_CHAINING is not compatible with TFT_SHARED_IO."
+  #endif
+#endif
+
+#if ENABLED(TFT_GLYPH_CACHE)
+  #if DISABLED(TFT_COLOR_UI)
+    #error "TFT_GLYPH_CACHE requires TFT_COLOR_UI."
+  #elif !WITHIN(TFT_GLYPH_CACHE_SIZE, 1, 255)
+    #error "TFT_GLYPH_CACHE_SIZE must be between 1 and 255."
+  #elif !WITHIN(TFT_GLYPH_CACHE_PIXELS, 16, 65025)
+    #error "TFT_GLYPH_CACHE_PIXELS must be between 16 and 65025 (255 * 255)."
+  #endif
+#endif
+
 #if ALL(CHIRON_TFT_STANDARD, CHIRON_TFT_NEW)
   #error "Please select only one of CHIRON_TFT_STANDARD or CHIRON_TFT_NEW."
 #endif
@@ -3912,6 +4000,8 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #elif ALL(IS_CARTESIAN, POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MIN && !defined(POWER_LOSS_ZHOME_POS)
     #error "POWER_LOSS_RECOVER_ZHOME requires POWER_LOSS_ZHOME_POS for a Cartesian that homes to ZMIN."
   #endif
+#elif ENABLED(POWER_LOSS_ASYNC_WRITE)
+  #error "POWER_LOSS_ASYNC_WRITE requires POWER_LOSS_RECOVERY."
 #endif
 
 #if ENABLED(Z_STEPPER_AUTO_ALIGN)
@@ -3921,9 +4011,6 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #error "Z_STEPPER_AUTO_ALIGN requires a Z-bed probe."
   #elif HAS_Z_STEPPER_ALIGN_STEPPER_XY
     static_assert(WITHIN(Z_STEPPER_ALIGN_AMP, 0.5, 2.0), "Z_STEPPER_ALIGN_AMP must be between 0.5 and 2.0.");
-    #if NUM_Z_STEPPERS < 3
-      #error "Z_STEPPER_ALIGN_STEPPER_XY requires 3 or 4 Z steppers."
-    #endif
   #endif
   static_assert(WITHIN(Z_STEPPER_ALIGN_ACC, 0.001, 1.0), "Z_STEPPER_ALIGN_ACC needs to be between 0.001 and 1.0");
 #endif
@@ -3999,9 +4086,23 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #error "CHDK_DELAY has been replaced by PHOTO_SWITCH_MS."
   #elif PIN_EXISTS(CHDK) && !defined(PHOTO_SWITCH_MS)
     #error "PHOTO_SWITCH_MS is required with CHDK_PIN."
+  #elif ENABLED(PHOTO_ENCODER_SETTLE) && DISABLED(I2C_POSITION_ENCODERS)
+    #error "PHOTO_ENCODER_SETTLE requires I2C_POSITION_ENCODERS."
+  #elif ENABLED(PHOTO_ENCODER_SETTLE) && defined(PHOTO_SWITCH_POSITION)
+    #error "PHOTO_ENCODER_SETTLE is not compatible with PHOTO_SWITCH_POSITION."
+  #elif ENABLED(PHOTO_ENCODER_SETTLE) && !(PIN_EXISTS(CHDK) || PIN_EXISTS(PHOTOGRAPH))
+    #error "PHOTO_ENCODER_SETTLE requires CHDK_PIN or PHOTOGRAPH_PIN."
+  #elif ENABLED(PHOTO_STROBE) && !(PIN_EXISTS(CHDK) || PIN_EXISTS(PHOTOGRAPH))
+    #error "PHOTO_STROBE requires CHDK_PIN or PHOTOGRAPH_PIN."
+  #elif ENABLED(PHOTO_STROBE) && !PIN_EXISTS(PHOTO_STROBE)
+    #error "PHOTO_STROBE requires a valid PHOTO_STROBE_PIN."
   #elif defined(PHOTO_RETRACT_MM)
     static_assert(PHOTO_RETRACT_MM + 0 >= 0, "PHOTO_RETRACT_MM must be >= 0.");
   #endif
+  // The strobe can't switch a pin the case light drives by PWM
+  #if ALL(PHOTO_STROBE, CASELIGHT_USES_BRIGHTNESS) && PIN_EXISTS(CASE_LIGHT)
+    static_assert(PHOTO_STROBE_PIN != CASE_LIGHT_PIN, "PHOTO_STROBE_PIN can't be the CASE_LIGHT_PIN unless CASE_LIGHT_NO_BRIGHTNESS is enabled.");
+  #endif
 #endif
 
 /**
@@ -4268,6 +4369,35 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
 #if ALL(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
+#if ENABLED(BINARY_FILE_TRANSFER)
+  #if !WITHIN(BINARY_STREAM_WINDOW_BITS, 4, 15)
+    #error "BINARY_STREAM_WINDOW_BITS must be between 4 and 15."
+  #elif !WITHIN(BINARY_STREAM_LOOKAHEAD_BITS, 3, (BINARY_STREAM_WINDOW_BITS) - 1)
+    #error "BINARY_STREAM_LOOKAHEAD_BITS must be between 3 and BINARY_STREAM_WINDOW_BITS - 1."
+  #elif !WITHIN(BINARY_STREAM_WRITE_BUFFERS, 1, 8)
+    #error "BINARY_STREAM_WRITE_BUFFERS must be between 1 and 8."
+  #endif
+#endif
+
+/**
+ * Binary reports
+ */
+#if ENABLED(POSITION_TELEMETRY)
+  #if DISABLED(BINARY_REPORTS)
+    #error "POSITION_TELEMETRY requires BINARY_REPORTS."
+  #elif !WITHIN(POSITION_TELEMETRY_BUFFER, 2, 128) || (POSITION_TELEMETRY_BUFFER & (POSITION_TELEMETRY_BUFFER - 1))
+    #error "POSITION_TELEMETRY_BUFFER must be a power of 2 from 2 to 128."
+  #endif
+#endif
+#if ENABLED(BINARY_MESH)
+  #if DISABLED(BINARY_REPORTS)
+    #error "BINARY_MESH requires BINARY_REPORTS."
+  #elif !HAS_MESH
+    #error "BINARY_MESH requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR, or AUTO_BED_LEVELING_UBL."
+  #elif GRID_MAX_POINTS_X > 126
+    #error "BINARY_MESH requires GRID_MAX_POINTS_X of 126 or less to fit a row in one frame."
+  #endif
+#endif
 
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
@@ -4587,6 +4717,16 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #if HAS_DYNAMIC_FREQ_G
     static_assert(FTM_DEFAULT_DYNFREQ_MODE != dynFreqMode_MASS_BASED, "dynFreqMode_MASS_BASED requires an X axis and an extruder.");
   #endif
+  #if ENABLED(FTM_LASER_POWER)
+    #if DISABLED(LASER_FEATURE)
+      #error "FTM_LASER_POWER requires LASER_FEATURE."
+    #elif !HAS_Y_AXIS
+      #error "FTM_LASER_POWER requires X and Y axes."
+    #endif
+    static_assert((FTM_STEPPERCMD_BUFF_SIZE) % (FTM_STEPS_PER_UNIT_TIME) == 0, "FTM_LASER_POWER requires FTM_STEPPERCMD_BUFF_SIZE to be a multiple of FTM_STEPS_PER_UNIT_TIME.");
+  #endif
+#elif ENABLED(FTM_LASER_POWER)
+  #error "FTM_LASER_POWER requires FT_MOTION."
 #endif
 
 // Multi-Stepping Limit
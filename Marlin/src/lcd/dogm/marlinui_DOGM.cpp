@@ -296,14 +296,78 @@ bool MarlinUI::detected() { return true; }
   #include "status_screen_lite_ST7920.h"
 #endif
 
+#if ENABLED(DOGM_SKIP_UNCHANGED_PAGES)
+
+  /**
+   * Keep a CRC-32 of each page sent to the display and don't send a page
+   * that comes out the same as last time. Most of the Status Screen doesn't
+   * change between refreshes, so this saves most of the SPI / I2C traffic.
+   * The display controller keeps showing the pixels it already has.
+   * Pages are still drawn into the page buffer. Only the transfer is skipped.
+   */
+  namespace DirtyPages {
+    constexpr uint8_t max_pages = 16;
+    uint32_t page_crc[max_pages];
+    uint16_t page_valid; // = 0
+    u8g_dev_fnptr device_fn;
+
+    void invalidate() { page_valid = 0; }
+
+    // CRC-32 (IEEE 802.3), a nibble at a time to keep the table small
+    uint32_t crc32(const uint8_t *ptr, uint16_t bytes) {
+      static const uint32_t crc_table[16] PROGMEM = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+      };
+      uint32_t crc = 0xFFFFFFFF;
+      while (bytes--) {
+        crc ^= *ptr++;
+        crc = (crc >> 4) ^ pgm_read_dword(&crc_table[crc & 0x0F]);
+        crc = (crc >> 4) ^ pgm_read_dword(&crc_table[crc & 0x0F]);
+      }
+      return ~crc;
+    }
+
+    uint8_t dev_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
+      if (msg == U8G_DEV_MSG_PAGE_NEXT) {
+        u8g_pb_t * const pb = (u8g_pb_t *)dev->dev_mem;
+        const uint8_t page = pb->p.page;
+        if (page < max_pages) {
+          const uint16_t bytes = uint16_t(pb->width) * pb->p.page_height / 8;
+          const uint32_t crc = crc32((uint8_t *)pb->buf, bytes);
+
+          if (TEST(page_valid, page) && page_crc[page] == crc) {
+            // Skip the transfer and move to the next page, as the page buffer base does
+            if (!u8g_page_Next(&pb->p)) return 0;
+            memset(pb->buf, 0, bytes);
+            return 1;
+          }
+          page_crc[page] = crc;
+          SBI(page_valid, page);
+        }
+      }
+      return device_fn(u8g, dev, msg, arg);
+    }
+
+    // Hook the device itself so rotation wrappers also go through dev_fn
+    void init(u8g_dev_t * const dev) {
+      device_fn = dev->dev_fn;
+      dev->dev_fn = dev_fn;
+    }
+  }
+
+#endif
+
 // Initialize or re-initialize the LCD
 void MarlinUI::init_lcd() {
 
   static bool did_init_u8g = false;
   if (!did_init_u8g) {
     u8g.init(U8G_PARAM);
+    TERN_(DOGM_SKIP_UNCHANGED_PAGES, DirtyPages::init(u8g.getU8g()->dev));
     did_init_u8g = true;
   }
+  TERN_(DOGM_SKIP_UNCHANGED_PAGES, DirtyPages::invalidate());
 
   #if PIN_EXISTS(LCD_BACKLIGHT)
     OUT_WRITE(LCD_BACKLIGHT_PIN, DISABLED(DELAYED_BACKLIGHT_INIT)); // Illuminate after reset or right away
@@ -387,6 +451,8 @@ void MarlinUI::clear_lcd() {
 // U8G displays are drawn over multiple loops so must do their own clearing.
 void MarlinUI::clear_for_drawing() {
   // Automatically cleared by Picture Loop
+  // Send every page of a new screen in case the display missed something
+  TERN_(DOGM_SKIP_UNCHANGED_PAGES, DirtyPages::invalidate());
 }
 
 #if HAS_DISPLAY_SLEEP
@@ -69,6 +69,83 @@ void Canvas::setBackground(uint16_t color) {
 
 extern uint16_t gradient(uint16_t colorA, uint16_t colorB, uint16_t factor);
 
+#if ENABLED(TFT_GLYPH_CACHE)
+
+  // Glyphs expanded to ready-to-copy pixels for a given text / background color
+  typedef struct {
+    glyph_t *glyph;
+    uint16_t color, background;
+    uint16_t transparent;         // Pixel value marking pixels the glyph doesn't set
+    uint32_t lastUsed;
+    uint16_t pixels[TFT_GLYPH_CACHE_PIXELS];
+  } cachedGlyph_t;
+
+  static cachedGlyph_t glyphCache[TFT_GLYPH_CACHE_SIZE];
+  static uint32_t glyphCacheClock;
+
+  /**
+   * Draw a glyph from the cache, expanding it into the least recently used
+   * entry on a miss. Return false if the glyph is too large to be cached.
+   */
+  bool Canvas::addCachedGlyph(int16_t x, int16_t y, glyph_t *pGlyph, uint16_t color, uint16_t *colors) {
+    const uint8_t glyph_width = pGlyph->bbxWidth, glyph_height = pGlyph->bbxHeight;
+    if (glyph_width * glyph_height > TFT_GLYPH_CACHE_PIXELS) return false;
+    if (y >= endLine || y + glyph_height <= startLine) return true;
+
+    const bool greyscale2 = getFontType() == FONT_MARLIN_GLYPHS_2BPP;
+    const uint16_t background = greyscale2 ? background_color : 0; // Only anti-aliased glyphs blend with the background
+
+    cachedGlyph_t *entry = nullptr, *oldest = &glyphCache[0];
+    for (cachedGlyph_t &cached : glyphCache) {
+      if (cached.glyph == pGlyph && cached.color == color && cached.background == background) { entry = &cached; break; }
+      if (cached.lastUsed < oldest->lastUsed) oldest = &cached;
+    }
+
+    if (!entry) {
+      entry = oldest;
+      entry->glyph = pGlyph;
+      entry->color = color;
+      entry->background = background;
+
+      // Pick a transparent marker that none of the glyph colors use
+      uint16_t transparent = ~color;
+      if (greyscale2) for (transparent = 0; transparent == colors[0] || transparent == colors[1] || transparent == colors[2];) transparent++;
+      entry->transparent = transparent;
+
+      const uint8_t bitsPerPixel = greyscale2 ? 2 : 1, mask = 0xFF >> (8 - bitsPerPixel);
+      uint8_t *data = ((uint8_t *)pGlyph) + sizeof(glyph_t);
+      uint16_t *pixel = entry->pixels;
+      for (uint8_t i = 0; i < glyph_height; i++) {
+        uint8_t offset = 8 - bitsPerPixel;
+        for (uint8_t j = 0; j < glyph_width; j++) {
+          if (offset > 8) {
+            data++;
+            offset = 8 - bitsPerPixel;
+          }
+          const uint8_t index = ((*data) >> offset) & mask;
+          *pixel++ = index ? (greyscale2 ? colors[index - 1] : color) : transparent;
+          offset -= bitsPerPixel;
+        }
+        data++;
+      }
+    }
+
+    entry->lastUsed = ++glyphCacheClock;
+
+    const uint16_t *pixels = entry->pixels;
+    for (int16_t i = 0; i < glyph_height; i++, pixels += glyph_width) {
+      const int16_t line = y + i;
+      if (!WITHIN(line, startLine, endLine - 1)) continue;
+      uint16_t *pixel = buffer + x + (line - startLine) * width;
+      for (int16_t j = 0; j < glyph_width; j++, pixel++)
+        if (pixels[j] != entry->transparent && WITHIN(x + j, 0, width - 1)) *pixel = pixels[j];
+    }
+
+    return true;
+  }
+
+#endif // TFT_GLYPH_CACHE
+
 void Canvas::addText(uint16_t x, uint16_t y, uint16_t color, uint16_t *string, uint16_t maxWidth) {
   if (endLine < y || startLine > y + getFontHeight()) return;
 
@@ -85,6 +162,12 @@ void Canvas::addText(uint16_t x, uint16_t y, uint16_t color, uint16_t *string, u
   for (uint16_t i = 0 ; *(string + i) ; i++) {
     glyph_t *pGlyph = glyph(string + i);
     if (stringWidth + pGlyph->bbxWidth > maxWidth) break;
+    #if ENABLED(TFT_GLYPH_CACHE)
+      if (addCachedGlyph(x + stringWidth + pGlyph->bbxOffsetX, y + getFontAscent() - pGlyph->bbxHeight - pGlyph->bbxOffsetY, pGlyph, color, colors)) {
+        stringWidth += pGlyph->dWidth;
+        continue;
+      }
+    #endif
     switch (getFontType()) {
       case FONT_MARLIN_GLYPHS_1BPP:
         addImage(x + stringWidth + pGlyph->bbxOffsetX, y + getFontAscent() - pGlyph->bbxHeight - pGlyph->bbxOffsetY, pGlyph->bbxWidth, pGlyph->bbxHeight, GREYSCALE1, ((uint8_t *)pGlyph) + sizeof(glyph_t), &color);
@@ -41,6 +41,9 @@ class Canvas {
 
     static void addImage(int16_t x, int16_t y, uint8_t image_width, uint8_t image_height, colorMode_t color_mode, uint8_t *data, uint16_t *colors);
     static void addImage(uint16_t x, uint16_t y, uint16_t imageWidth, uint16_t imageHeight, uint16_t color, uint16_t bgColor, uint8_t *image);
+    #if ENABLED(TFT_GLYPH_CACHE)
+      static bool addCachedGlyph(int16_t x, int16_t y, glyph_t *pGlyph, uint16_t color, uint16_t *colors);
+    #endif
 
   public:
     static void instantiate(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
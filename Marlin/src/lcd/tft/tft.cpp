@@ -35,6 +35,7 @@ uint16_t TFT::buffer[];
 void TFT::init() {
   io.init();
   io.initTFT();
+  TERN_(TFT_QUEUE_DMA_CHAINING, io.setDMACallback(TFT_Queue::transfer_complete));
 }
 
 TFT tft;
@@ -30,26 +30,32 @@
 
 uint8_t TFT_Queue::queue[];
 uint8_t *TFT_Queue::end_of_queue = queue;
-uint8_t *TFT_Queue::current_task = nullptr;
+uint8_t * volatile TFT_Queue::current_task = nullptr;
 uint8_t *TFT_Queue::last_task = nullptr;
 uint8_t *TFT_Queue::last_parameter = nullptr;
+millis_t TFT_Queue::frame_start;
+uint16_t TFT_Queue::frame_time, TFT_Queue::max_frame_time;
 
 void TFT_Queue::reset() {
+  TERN_(TFT_QUEUE_DMA_CHAINING, hal.isr_off()); // Don't let a completing transfer start the next one
   tft.abort();
 
   end_of_queue = queue;
   current_task = nullptr;
   last_task = nullptr;
   last_parameter = nullptr;
+  TERN_(TFT_QUEUE_DMA_CHAINING, hal.isr_on());
 }
 
 void TFT_Queue::async() {
   if (!current_task) return;
-  queueTask_t *task = (queueTask_t *)current_task;
 
   // Check IO busy status
   if (tft.is_busy()) return;
 
+  // Read the task only once IO is idle, since transfer_complete() may have moved on
+  queueTask_t *task = (queueTask_t *)current_task;
+
   if (task->state == TASK_STATE_COMPLETED) {
     task = (queueTask_t *)task->nextTask;
     current_task = (uint8_t *)task;
@@ -58,12 +64,39 @@ void TFT_Queue::async() {
   finish_sketch();
 
   switch (task->type) {
-    case TASK_END_OF_QUEUE: reset();      break;
+    case TASK_END_OF_QUEUE:
+      frame_time = millis() - frame_start;
+      NOLESS(max_frame_time, frame_time);
+      if (DEBUGGING(INFO)) SERIAL_ECHOLNPGM("TFT frame: ", frame_time, "ms (max ", max_frame_time, "ms)");
+      reset();
+      break;
     case TASK_FILL:         fill(task);   break;
     case TASK_CANVAS:       canvas(task); break;
   }
 }
 
+#if ENABLED(TFT_QUEUE_DMA_CHAINING)
+
+  /**
+   * Called from the DMA interrupt when a non-blocking transfer ends.
+   * Fill tasks need no rendering, so keep the display busy with them right
+   * here. Canvas tasks and the end of the queue are left to async().
+   */
+  void TFT_Queue::transfer_complete() {
+    queueTask_t *task = (queueTask_t *)current_task;
+    if (!task || task->type != TASK_FILL) return;
+
+    if (task->state == TASK_STATE_COMPLETED) {
+      queueTask_t *next = (queueTask_t *)task->nextTask;
+      if (next->type != TASK_FILL || next->state != TASK_STATE_READY) return;
+      current_task = (uint8_t *)(task = next);
+    }
+
+    fill(task);
+  }
+
+#endif
+
 void TFT_Queue::finish_sketch() {
   if (!last_task) return;
   queueTask_t *task = (queueTask_t *)last_task;
@@ -73,7 +106,7 @@ void TFT_Queue::finish_sketch() {
     task->nextTask = end_of_queue;
     task->state = TASK_STATE_READY;
 
-    if (!current_task) current_task = (uint8_t *)task;
+    if (!current_task) begin_frame((uint8_t *)task);
   }
 }
 
@@ -163,9 +196,10 @@ void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, ui
   *end_of_queue = TASK_END_OF_QUEUE;
   task->nextTask = end_of_queue;
   task->state = TASK_STATE_READY;
+  TERN_(TFT_QUEUE_DMA_CHAINING, __DMB()); // transfer_complete() may start this task as soon as it is typed
   task->type = TASK_FILL;
 
-  if (!current_task) current_task = (uint8_t *)task;
+  if (!current_task) begin_frame((uint8_t *)task);
 }
 
 void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
@@ -189,7 +223,7 @@ void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
   task_parameters->height = height;
   task_parameters->count = 0;
 
-  if (!current_task) current_task = (uint8_t *)task;
+  if (!current_task) begin_frame((uint8_t *)task);
 }
 
 void TFT_Queue::set_background(uint16_t color) {
@@ -122,18 +122,25 @@ class TFT_Queue {
   private:
     static uint8_t queue[TFT_QUEUE_SIZE];
     static uint8_t *end_of_queue;
-    static uint8_t *current_task;
+    static uint8_t * volatile current_task; // Advanced by transfer_complete() with TFT_QUEUE_DMA_CHAINING
     static uint8_t *last_task;
     static uint8_t *last_parameter;
+    static millis_t frame_start;
 
+    static void begin_frame(uint8_t *task) { current_task = task; frame_start = millis(); }
     static void finish_sketch();
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
     static void handle_queue_overflow(uint16_t sizeNeeded);
 
   public:
+    static uint16_t frame_time, max_frame_time; // (ms) From the first queued task until the queue is drawn
+
     static void reset();
     static void async();
+    #if ENABLED(TFT_QUEUE_DMA_CHAINING)
+      static void transfer_complete();
+    #endif
     static void sync() { while (current_task != nullptr) async(); }
     static bool is_empty() { return current_task == nullptr; }
 
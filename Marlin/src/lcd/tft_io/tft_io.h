@@ -76,6 +76,11 @@ public:
   inline static void writeSequenceDMA(uint16_t *data, uint16_t count) { io.writeSequence_DMA(data, count); }
   inline static void WriteMultipleDMA(uint16_t color, uint16_t count) { io.writeMultiple_DMA(color, count); }
 
+  // Completion callback for the non-blocking DMA-based IO above, called from the DMA interrupt
+  #if ENABLED(TFT_QUEUE_DMA_CHAINING)
+    inline static void setDMACallback(void (*callback)()) { io.setDMACallback(callback); }
+  #endif
+
   // Non-blocking DMA-based IO with IRQ callback used by TFT_LVGL_UI only
   // This function starts data transfer using DMA and does NOT wait for data transfer completion
   #if ENABLED(USE_SPI_DMA_TC)
@@ -14,9 +14,10 @@
   #define HEATSHRINK_FREE(P, SZ) free(P)
 #else
   // Required parameters for static configuration
+  // The window is the largest a stream may use and the lookahead is the default (see heatshrink_decoder_configure)
   #define HEATSHRINK_STATIC_INPUT_BUFFER_SIZE 32
-  #define HEATSHRINK_STATIC_WINDOW_BITS 8
-  #define HEATSHRINK_STATIC_LOOKAHEAD_BITS 4
+  #define HEATSHRINK_STATIC_WINDOW_BITS BINARY_STREAM_WINDOW_BITS
+  #define HEATSHRINK_STATIC_LOOKAHEAD_BITS BINARY_STREAM_LOOKAHEAD_BITS
 #endif
 
 // Turn on logging for debugging
@@ -105,6 +105,19 @@ void heatshrink_decoder_free(heatshrink_decoder *hsd) {
   HEATSHRINK_FREE(hsd, sz);
   (void)sz;   /* may not be used by free */
 }
+#else
+bool heatshrink_decoder_configure(heatshrink_decoder *hsd, uint8_t window_sz2, uint8_t lookahead_sz2) {
+  if ((window_sz2 < HEATSHRINK_MIN_WINDOW_BITS) ||
+      (window_sz2 > HEATSHRINK_STATIC_WINDOW_BITS) ||
+      (lookahead_sz2 < HEATSHRINK_MIN_LOOKAHEAD_BITS) ||
+      (lookahead_sz2 >= window_sz2)) {
+    return false;
+  }
+  hsd->window_sz2 = window_sz2;
+  hsd->lookahead_sz2 = lookahead_sz2;
+  heatshrink_decoder_reset(hsd);
+  return true;
+}
 #endif
 
 void heatshrink_decoder_reset(heatshrink_decoder *hsd) {
@@ -60,10 +60,10 @@ typedef enum {
 #else
 #define HEATSHRINK_DECODER_INPUT_BUFFER_SIZE(_) \
   HEATSHRINK_STATIC_INPUT_BUFFER_SIZE
-#define HEATSHRINK_DECODER_WINDOW_BITS(_) \
-  (HEATSHRINK_STATIC_WINDOW_BITS)
+#define HEATSHRINK_DECODER_WINDOW_BITS(BUF) \
+  ((BUF)->window_sz2)
 #define HEATSHRINK_DECODER_LOOKAHEAD_BITS(BUF) \
-  (HEATSHRINK_STATIC_LOOKAHEAD_BITS)
+  ((BUF)->lookahead_sz2)
 #endif
 
 typedef struct {
@@ -85,8 +85,12 @@ typedef struct {
   /* Input buffer, then expansion window buffer */
   uint8_t buffers[];
 #else
+  /* Stream settings, up to the static maximums */
+  uint8_t window_sz2;         /* window buffer bits */
+  uint8_t lookahead_sz2;      /* lookahead bits */
+
   /* Input buffer, then expansion window buffer */
-  uint8_t buffers[(1 << HEATSHRINK_DECODER_WINDOW_BITS(_)) + HEATSHRINK_DECODER_INPUT_BUFFER_SIZE(_)];
+  uint8_t buffers[(1 << HEATSHRINK_STATIC_WINDOW_BITS) + HEATSHRINK_DECODER_INPUT_BUFFER_SIZE(_)];
 #endif
 } heatshrink_decoder;
 
@@ -100,6 +104,11 @@ heatshrink_decoder *heatshrink_decoder_alloc(uint16_t input_buffer_size, uint8_t
 
 /* Free a decoder. */
 void heatshrink_decoder_free(heatshrink_decoder *hsd);
+#else
+/* Set the window and lookahead bits used to compress the stream, which may
+ * be less than the static maximums, and reset the decoder.
+ * Returns false if the settings are out of range. */
+bool heatshrink_decoder_configure(heatshrink_decoder *hsd, uint8_t window_sz2, uint8_t lookahead_sz2);
 #endif
 
 /* Reset a decoder. */
@@ -28,6 +28,10 @@
 #include "stepper.h" // Access stepper block queue function and abort status.
 #include "endstops.h"
 
+#if ENABLED(FTM_LASER_POWER)
+  #include "../feature/spindle_laser.h"
+#endif
+
 FTMotion ftMotion;
 
 //-----------------------------------------------------------------
@@ -44,6 +48,10 @@ int32_t FTMotion::stepperCmdBuff_produceIdx = 0, // Index of next stepper comman
 
 bool FTMotion::sts_stepperBusy = false;         // The stepper buffer has items and is in use.
 
+#if ENABLED(FTM_LASER_POWER)
+  uint8_t FTMotion::cutterPowerBuff[FTM_POWER_BUFF_SIZE] = {0U}; // Laser power for each point in the stepper commands buffer.
+#endif
+
 XYZEval<millis_t> FTMotion::axis_move_end_ti = { 0 };
 AxisBits FTMotion::axis_move_dir;
 
@@ -80,6 +88,13 @@ uint32_t FTMotion::N1,                          // Number of data points in the
 
 uint32_t FTMotion::max_intervals;               // Total number of data points that will be generated from block.
 
+#if ENABLED(FTM_LASER_POWER)
+  float FTMotion::laserPower_P,                 // (ocr) Laser power of block.
+        FTMotion::laserPowerPerSpeed;           // (ocr/(mm/s)) Laser power per unit speed, or 0 for constant power.
+  uint8_t FTMotion::trajPower[FTM_WINDOW_SIZE], // Laser power of each point in the trajectory window.
+          FTMotion::trajModPower[FTM_BATCH_SIZE]; // Laser power of each point in the batch being interpolated.
+#endif
+
 // Make vector variables.
 uint32_t FTMotion::makeVector_idx = 0,          // Index of fixed time trajectory generation of the overall block.
          FTMotion::makeVector_batchIdx = 0;     // Index of fixed time trajectory generation within the batch.
@@ -179,6 +194,8 @@ void FTMotion::loop() {
 
     // Call Ulendo FBS here.
 
+    TERN_(FTM_LASER_POWER, memcpy(trajModPower, trajPower, sizeof(trajModPower)));
+
     #if ENABLED(FTM_UNIFIED_BWS)
       trajMod = traj; // Move the window to traj
     #else
@@ -189,6 +206,7 @@ void FTMotion::loop() {
       // Shift the time series back in the window
       #define TSHIFT(A) memcpy(traj.A, &traj.A[FTM_BATCH_SIZE], BATCH_SIDX_IN_WINDOW * sizeof(traj.A[0]));
       LOGICAL_AXIS_MAP_LC(TSHIFT);
+      TERN_(FTM_LASER_POWER, memcpy(trajPower, &trajPower[FTM_BATCH_SIZE], BATCH_SIDX_IN_WINDOW * sizeof(trajPower[0])));
     #endif
 
     // ... data is ready in trajMod.
@@ -385,11 +403,17 @@ void FTMotion::reset() {
   #if HAS_FTM_SHAPING
     TERN_(HAS_X_AXIS, ZERO(shaping.x.d_zi));
     TERN_(HAS_Y_AXIS, ZERO(shaping.y.d_zi));
+    TERN_(FTM_LASER_POWER, ZERO(shaping.pwr_zi));
     shaping.zi_idx = 0;
   #endif
 
   TERN_(HAS_EXTRUDERS, e_raw_z1 = e_advanced_z1 = 0.0f);
 
+  #if ENABLED(FTM_LASER_POWER)
+    laserPower_P = laserPowerPerSpeed = 0.0f;
+    ZERO(trajPower);
+  #endif
+
   axis_move_end_ti.reset();
 }
 
@@ -420,6 +444,9 @@ void FTMotion::runoutBlock() {
   startPosn = endPosn_prevBlock;
   ratio.reset();
 
+  // The laser is off while motion settles
+  TERN_(FTM_LASER_POWER, laserPower_P = laserPowerPerSpeed = 0.0f);
+
   const int32_t n_to_fill_batch = (FTM_WINDOW_SIZE) - makeVector_batchIdx;
 
   // This line or function is to be modified for FBS use; do not optimize out.
@@ -554,6 +581,15 @@ void FTMotion::loadBlockData(block_t * const current_block) {
 
   endPosn_prevBlock += moveDist;
 
+  #if ENABLED(FTM_LASER_POWER)
+    // Power in Dynamic mode (and with LASER_POWER_TRAP) follows the speed, reaching full power at nominal speed
+    const bool laser_on = current_block->laser.status.isEnabled && current_block->laser.status.isPowered;
+    laserPower_P = laser_on ? current_block->laser.power : 0;
+    laserPowerPerSpeed = (current_block->nominal_speed > 0.0f
+                          && (ENABLED(LASER_POWER_TRAP) || cutter.cutter_mode == CUTTER_MODE_DYNAMIC))
+                         ? laserPower_P / current_block->nominal_speed : 0.0f;
+  #endif
+
   // Watch endstops until the move ends
   const millis_t move_end_ti = millis() + SEC_TO_MS((FTM_TS) * float(max_intervals + num_samples_shaper_settle() + ((PROP_BATCHES) + 1) * (FTM_BATCH_SIZE)) + (float(FTM_STEPPERCMD_BUFF_SIZE) / float(FTM_STEPPER_FS)));
 
@@ -582,22 +618,28 @@ void FTMotion::makeVector() {
     float accel_k = 0.0f;                                 // (mm/s^2) Acceleration K factor
     float tau = (makeVector_idx + 1) * (FTM_TS);          // (s) Time since start of block
     float dist = 0.0f;                                    // (mm) Distance traveled
+    #if ENABLED(FTM_LASER_POWER)
+      float speed;                                        // (mm/s) Speed along the path
+    #endif
 
     if (makeVector_idx < N1) {
       // Acceleration phase
       dist = (f_s * tau) + (0.5f * accel_P * sq(tau));    // (mm) Distance traveled for acceleration phase since start of block
       accel_k = accel_P;                                  // (mm/s^2) Acceleration K factor from Accel phase
+      TERN_(FTM_LASER_POWER, speed = f_s + accel_P * tau);
     }
     else if (makeVector_idx < (N1 + N2)) {
       // Coasting phase
       dist = s_1e + F_P * (tau - N1 * (FTM_TS));          // (mm) Distance traveled for coasting phase since start of block
       //accel_k = 0.0f;
+      TERN_(FTM_LASER_POWER, speed = F_P);
     }
     else {
       // Deceleration phase
       tau -= (N1 + N2) * (FTM_TS);                        // (s) Time since start of decel phase
       dist = s_2e + F_P * tau + 0.5f * decel_P * sq(tau); // (mm) Distance traveled for deceleration phase since start of block
       accel_k = decel_P;                                  // (mm/s^2) Acceleration K factor from Decel phase
+      TERN_(FTM_LASER_POWER, speed = F_P + decel_P * tau);
     }
 
     #define _SET_TRAJ(q) traj.q[makeVector_batchIdx] = startPosn.q + ratio.q * dist;
@@ -614,6 +656,10 @@ void FTMotion::makeVector() {
       }
     #endif
 
+    #if ENABLED(FTM_LASER_POWER)
+      float pwr = laserPowerPerSpeed ? laserPowerPerSpeed * speed : laserPower_P;
+    #endif
+
     // Update shaping parameters if needed.
 
     switch (cfg.dynFreqMode) {
@@ -675,9 +721,24 @@ void FTMotion::makeVector() {
           }
         }
       #endif
+      #if ENABLED(FTM_LASER_POWER)
+        // Delay the power with the X (or Y) shaper so it follows the shaped path
+        shaping.pwr_zi[shaping.zi_idx] = pwr;
+        const axis_shaping_t &pshape = shaping.x.ena ? shaping.x : shaping.y;
+        if (pshape.ena) {
+          pwr *= pshape.Ai[0];
+          for (uint32_t i = 1U; i <= pshape.max_i; i++) {
+            const uint32_t udiffp = shaping.zi_idx - pshape.Ni[i];
+            pwr += pshape.Ai[i] * shaping.pwr_zi[pshape.Ni[i] > shaping.zi_idx ? (FTM_ZMAX) + udiffp : udiffp];
+          }
+        }
+      #endif
+
       if (++shaping.zi_idx == (FTM_ZMAX)) shaping.zi_idx = 0;
     #endif // HAS_FTM_SHAPING
 
+    TERN_(FTM_LASER_POWER, trajPower[makeVector_batchIdx] = uint8_t(LROUND(constrain(pwr, 0.0f, 255.0f))));
+
     // Filled up the queue with regular and shaped steps
     if (++makeVector_batchIdx == FTM_WINDOW_SIZE) {
       makeVector_batchIdx = BATCH_SIDX_IN_WINDOW;
@@ -740,6 +801,9 @@ void FTMotion::convertToSteps(const uint32_t idx) {
   #define _COMMAND_SET(AXIS) command_set[_AXIS(AXIS)] = delta[_AXIS(AXIS)] >= 0 ? command_set_pos : command_set_neg;
   LOGICAL_AXIS_MAP(_COMMAND_SET);
 
+  // The ISR applies this power with the first command of the point
+  TERN_(FTM_LASER_POWER, cutterPowerBuff[stepperCmdBuff_produceIdx / (FTM_STEPS_PER_UNIT_TIME)] = trajModPower[idx]);
+
   for (uint32_t i = 0U; i < (FTM_STEPS_PER_UNIT_TIME); i++) {
 
     ft_command_t &cmd = stepperCmdBuff[stepperCmdBuff_produceIdx];
@@ -27,6 +27,10 @@
 
 #include "ft_types.h"
 
+#if ENABLED(FTM_LASER_POWER)
+  #define FTM_POWER_BUFF_SIZE ((FTM_STEPPERCMD_BUFF_SIZE) / (FTM_STEPS_PER_UNIT_TIME)) // One power value per trajectory point
+#endif
+
 #if HAS_X_AXIS && (HAS_Z_AXIS || HAS_EXTRUDERS)
   #define HAS_DYNAMIC_FREQ 1
   #if HAS_Z_AXIS
@@ -115,6 +119,10 @@ class FTMotion {
 
     static bool sts_stepperBusy;                          // The stepper buffer has items and is in use.
 
+    #if ENABLED(FTM_LASER_POWER)
+      static uint8_t cutterPowerBuff[FTM_POWER_BUFF_SIZE]; // Laser power for each point in the stepper command buffer.
+    #endif
+
     static XYZEval<millis_t> axis_move_end_ti;
     static AxisBits axis_move_dir;
 
@@ -155,6 +163,13 @@ class FTMotion {
                  s_2e;
 
     static uint32_t N1, N2, N3;
+
+    #if ENABLED(FTM_LASER_POWER)
+      static float laserPower_P,            // (ocr) Laser power of block
+                   laserPowerPerSpeed;      // (ocr/(mm/s)) Laser power scaled by speed, or 0 for constant power
+      static uint8_t trajPower[FTM_WINDOW_SIZE],
+                     trajModPower[FTM_BATCH_SIZE];
+    #endif
     static uint32_t max_intervals;
 
     // Number of batches needed to propagate the current trajectory to the stepper.
@@ -186,6 +201,9 @@ class FTMotion {
 
       typedef struct Shaping {
         uint32_t zi_idx;           // Index of storage in the data point delay vectors.
+        #if ENABLED(FTM_LASER_POWER)
+          float pwr_zi[FTM_ZMAX];  // Laser power delay vector.
+        #endif
         #if HAS_X_AXIS
           axis_shaping_t x;
         #endif
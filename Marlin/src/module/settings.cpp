@@ -653,6 +653,9 @@ typedef struct SettingsDataStruct {
   #if ENABLED(MPCTEMP)
     MPC_t mpc_constants[HOTENDS];                       // M306
   #endif
+  #if ENABLED(MPCTEMPBED)
+    MPCBed_t bed_mpc_constants;                         // M306 E-1
+  #endif
 
   //
   // Fixed-Time Motion
@@ -735,6 +738,7 @@ void MarlinSettings::postprocess() {
   TERN_(DELTA, recalc_delta_settings());
 
   TERN_(PIDTEMP, thermalManager.updatePID());
+  TERN_(MPCTEMPBED, thermalManager.temp_bed.update_model());
 
   #if DISABLED(NO_VOLUMETRICS)
     planner.calculate_volumetric_multipliers();
@@ -1763,6 +1767,9 @@ void MarlinSettings::postprocess() {
     #if ENABLED(MPCTEMP)
       HOTEND_LOOP() EEPROM_WRITE(thermalManager.temp_hotend[e].mpc);
     #endif
+    #if ENABLED(MPCTEMPBED)
+      EEPROM_WRITE(thermalManager.temp_bed.mpc);
+    #endif
 
     //
     // Fixed-Time Motion
@@ -2884,6 +2891,9 @@ void MarlinSettings::postprocess() {
       #if ENABLED(MPCTEMP)
         HOTEND_LOOP() EEPROM_READ(thermalManager.temp_hotend[e].mpc);
       #endif
+      #if ENABLED(MPCTEMPBED)
+        EEPROM_READ(thermalManager.temp_bed.mpc);
+      #endif
 
       //
       // Fixed-Time Motion
@@ -3211,7 +3221,7 @@ void MarlinSettings::postprocess() {
 
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
           if (into) {
-            float z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+            bed_mesh_t z_values;
             bedlevel.set_mesh_from_store(z_mesh_store, z_values);
             memcpy(into, z_values, sizeof(z_values));
           }
@@ -3875,6 +3885,12 @@ void MarlinSettings::reset() {
       mpc.filament_heat_capacity_permm = _filament_heat_capacity_permm[e];
     }
   #endif
+  #if ENABLED(MPCTEMPBED)
+    thermalManager.temp_bed.mpc.heater_power = MPC_BED_HEATER_POWER;
+    thermalManager.temp_bed.mpc.block_heat_capacity = MPC_BED_HEAT_CAPACITY;
+    thermalManager.temp_bed.mpc.sensor_responsiveness = MPC_BED_SENSOR_RESPONSIVENESS;
+    thermalManager.temp_bed.mpc.ambient_xfer_coeff = MPC_BED_AMBIENT_XFER_COEFF;
+  #endif
 
   //
   // Fixed-Time Motion
@@ -4243,7 +4259,9 @@ void MarlinSettings::reset() {
     //
     // Model predictive control
     //
-    TERN_(MPCTEMP, gcode.M306_report(forReplay));
+    #if ANY(MPCTEMP, MPCTEMPBED)
+      gcode.M306_report(forReplay);
+    #endif
 
     //
     // MMU3
@@ -3395,6 +3395,16 @@ int32_t Stepper::position(const AxisEnum axis) {
   return v;
 }
 
+/**
+ * Get all stepper positions in steps, from between two stepper ISRs.
+ */
+xyze_long_t Stepper::position() {
+  ATOMIC_SECTION_START();
+  const xyze_long_t v = count_position;
+  ATOMIC_SECTION_END();
+  return v;
+}
+
 /**
  * Set all axis stepper positions in steps
  */
@@ -3540,7 +3550,23 @@ void Stepper::report_positions() {
 
     // Check if the buffer is empty.
     ftMotion.sts_stepperBusy = (ftMotion.stepperCmdBuff_produceIdx != ftMotion.stepperCmdBuff_consumeIdx);
-    if (!ftMotion.sts_stepperBusy) return;
+    if (!ftMotion.sts_stepperBusy) {
+      // Make sure an inline laser is off once motion has stopped or was aborted
+      #if ENABLED(FTM_LASER_POWER)
+        if (cutter.cutter_mode != CUTTER_MODE_STANDARD) cutter.apply_power(0);
+      #endif
+      return;
+    }
+
+    #if ENABLED(FTM_LASER_POWER)
+      // Apply inline laser power with the first command of each trajectory point
+      if (cutter.cutter_mode != CUTTER_MODE_STANDARD) {
+        if (abort_current_block)
+          cutter.apply_power(0);
+        else if (ftMotion.stepperCmdBuff_consumeIdx % (FTM_STEPS_PER_UNIT_TIME) == 0)
+          cutter.apply_power(ftMotion.cutterPowerBuff[ftMotion.stepperCmdBuff_consumeIdx / (FTM_STEPS_PER_UNIT_TIME)]);
+      }
+    #endif
 
     // "Pop" one command from current motion buffer
     const ft_command_t command = ftMotion.stepperCmdBuff[ftMotion.stepperCmdBuff_consumeIdx];
@@ -564,6 +564,9 @@ class Stepper {
     // Get the position of a stepper, in steps
     static int32_t position(const AxisEnum axis);
 
+    // Get the positions of all steppers at one instant, in steps
+    static xyze_long_t position();
+
     // Set the current position in steps
     static void set_position(const xyze_long_t &spos);
     static void set_axis_position(const AxisEnum a, const int32_t &v);
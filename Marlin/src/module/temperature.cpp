@@ -228,6 +228,14 @@
   #include "../feature/joystick.h"
 #endif
 
+#if ENABLED(POSITION_TELEMETRY)
+  #include "../feature/binary_report.h"
+#endif
+
+#if ENABLED(PHOTO_STROBE)
+  #include "../feature/photo_strobe.h"
+#endif
+
 #if HAS_BEEPER
   #include "../libs/buzzer.h"
 #endif
@@ -540,7 +548,7 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
   #if WATCH_BED
     bed_watch_t Temperature::watch_bed; // = { 0 }
   #endif
-  #if DISABLED(PIDTEMPBED)
+  #if NONE(PIDTEMPBED, MPCTEMPBED)
     millis_t Temperature::next_bed_check_ms;
   #endif
 #endif
@@ -674,7 +682,7 @@ volatile bool Temperature::raw_temps_ready = false;
  * Class and Instance Methods
  */
 
-#if ANY(HAS_PID_HEATING, MPC_AUTOTUNE)
+#if ANY(HAS_PID_HEATING, MPC_AUTOTUNE, MPC_BED_AUTOTUNE)
 
   /**
    * Run the minimal required activities during a tuning loop.
@@ -1362,6 +1370,160 @@ volatile bool Temperature::raw_temps_ready = false;
 
 #endif // MPC_AUTOTUNE
 
+#if ENABLED(MPC_BED_AUTOTUNE)
+
+  /**
+   * MPC auto-tuning for the heated bed
+   *
+   * A bed is too slow to approach its asymptotic temperature in reasonable time,
+   * so the constants are found with the differential method:
+   *  - Measure the ambient temperature with the heater off.
+   *  - Heat at full power to MPC_BED_TUNING_TEMP, tracking the fastest rate of rise
+   *    to get the heat capacity and sensor responsiveness.
+   *  - Hold MPC_BED_TUNING_TEMP with the model and average the power needed
+   *    to get the ambient heat transfer coefficient.
+   */
+  void Temperature::MPC_autotune_bed() {
+    SERIAL_ECHOLNPGM(STR_MPC_BED_AUTOTUNE_START);
+
+    MPCBedHeaterInfo &bed = temp_bed;
+    MPCBed_t &mpc = bed.mpc;
+
+    disable_all_heaters();
+
+    millis_t curr_time_ms = millis(), next_report_ms = curr_time_ms;
+    celsius_float_t current_temp = degBed();
+
+    // Run minimal machine tasks and get the latest temperature. False if interrupted with M108.
+    auto housekeeping = [&]{
+      curr_time_ms = millis();
+      if (tuning_idle(curr_time_ms)) current_temp = degBed();
+      if (ELAPSED(curr_time_ms, next_report_ms)) {
+        next_report_ms += 1000UL;
+        print_heater_states(active_extruder);
+        SERIAL_EOL();
+      }
+      if (wait_for_heatup) return true;
+      SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_INTERRUPTED);
+      return false;
+    };
+
+    auto finish = [&]{
+      wait_for_heatup = false;
+      bed.target = 0;
+      bed.soft_pwm_amount = 0;
+      ui.reset_status();
+    };
+
+    // Determine ambient temperature
+    SERIAL_ECHOLNPGM(STR_MPC_COOLING_TO_AMBIENT);
+    LCD_MESSAGE(MSG_COOLING);
+
+    constexpr millis_t ambient_interval_ms = 30000UL;
+    millis_t next_test_ms = curr_time_ms + ambient_interval_ms;
+    celsius_float_t ambient_temp = current_temp;
+    wait_for_heatup = true;
+    for (;;) { // Can be interrupted with M108
+      if (!housekeeping()) return finish();
+      if (ELAPSED(curr_time_ms, next_test_ms)) {
+        if (current_temp >= ambient_temp) {
+          ambient_temp = (ambient_temp + current_temp) / 2.0f;
+          break;
+        }
+        ambient_temp = current_temp;
+        next_test_ms += ambient_interval_ms;
+      }
+    }
+
+    // Heat at full power, measuring the fastest rate of rise
+    SERIAL_ECHOLNPGM(STR_MPC_BED_HEATING_TO, MPC_BED_TUNING_TEMP);
+    LCD_MESSAGE(MSG_BED_HEATING);
+
+    constexpr millis_t heatup_interval_ms = 5000UL, heatup_timeout_ms = 30UL * 60UL * 1000UL;
+    const millis_t heat_start_ms = curr_time_ms;
+    next_test_ms = curr_time_ms + heatup_interval_ms;
+    celsius_float_t samples[3] = { current_temp, current_temp, current_temp }, temp_fastest = current_temp;
+    float rate_fastest = 0, time_fastest = 0;
+
+    bed.target = MPC_BED_TUNING_TEMP;   // So M105 looks nice
+    bed.soft_pwm_amount = MAX_BED_POWER >> 1;
+    for (;;) {
+      if (!housekeeping()) return finish();
+      if (ELAPSED(curr_time_ms, next_test_ms)) {
+        samples[0] = samples[1];
+        samples[1] = samples[2];
+        samples[2] = current_temp;
+        const float h = MS_TO_SEC_PRECISE(heatup_interval_ms),
+                    curr_rate = (samples[2] - samples[0]) / 2 / h;
+        if (curr_rate > rate_fastest) {
+          rate_fastest = curr_rate;
+          temp_fastest = samples[1];
+          time_fastest = MS_TO_SEC_PRECISE(curr_time_ms - heat_start_ms) - h;
+        }
+        if (current_temp >= MPC_BED_TUNING_TEMP) break;
+        next_test_ms += heatup_interval_ms;
+      }
+      if (ELAPSED(curr_time_ms, heat_start_ms + heatup_timeout_ms)) {
+        SERIAL_ECHOLNPGM(STR_MPC_TEMPERATURE_ERROR);
+        return finish();
+      }
+    }
+
+    // Differential tuning. Full power is (MAX_BED_POWER / 255) of the heater power.
+    const float full_power = mpc.heater_power * (MAX_BED_POWER) / 255;
+    mpc.block_heat_capacity = full_power / rate_fastest;
+    mpc.sensor_responsiveness = rate_fastest / (rate_fastest * time_fastest + ambient_temp - temp_fastest);
+    bed.update_model();
+
+    #if ENABLED(MPC_AUTOTUNE_DEBUG)
+      SERIAL_ECHOLNPGM("ambient_temp ", ambient_temp);
+      SERIAL_ECHOLNPGM("rate_fastest ", rate_fastest);
+      SERIAL_ECHOLNPGM("time_fastest ", time_fastest);
+      SERIAL_ECHOLNPGM("temp_fastest ", temp_fastest);
+    #endif
+
+    // Hold the tuning temperature under MPC and measure the heat loss
+    SERIAL_ECHOLNPGM(STR_MPC_MEASURING_AMBIENT, current_temp);
+    LCD_MESSAGE(MSG_MPC_MEASURING_AMBIENT);
+
+    bed.modeled_ambient_temp = ambient_temp;
+    bed.modeled_block_temp = bed.modeled_sensor_temp = current_temp;
+
+    const millis_t test_interval_ms = SEC_TO_MS(MPC_dT),
+                   settle_end_ms = curr_time_ms + MPC_BED_TUNING_SETTLE_MS,
+                   test_end_ms = settle_end_ms + MPC_BED_TUNING_TEST_MS;
+    next_test_ms = curr_time_ms + test_interval_ms;
+    float total_energy = 0.0f;
+    celsius_float_t last_temp = current_temp;
+    for (;;) {
+      if (!housekeeping()) return finish();
+      if (ELAPSED(curr_time_ms, next_test_ms)) {
+        bed.soft_pwm_amount = (int)get_pid_output_bed() >> 1;
+        if (ELAPSED(curr_time_ms, test_end_ms)) break;
+        if (ELAPSED(curr_time_ms, settle_end_ms))
+          total_energy += mpc.heater_power * bed.soft_pwm_amount / 127 * MPC_dT + (last_temp - current_temp) * mpc.block_heat_capacity;
+        last_temp = current_temp;
+        next_test_ms += test_interval_ms;
+      }
+      // Don't drift too far from the target temperature
+      if (!WITHIN(current_temp, bed.target - 15.0f, bed.target + 15.0f)) {
+        SERIAL_ECHOLNPGM(STR_MPC_TEMPERATURE_ERROR);
+        return finish();
+      }
+    }
+
+    mpc.ambient_xfer_coeff = total_energy / MS_TO_SEC_PRECISE(MPC_BED_TUNING_TEST_MS) / (bed.target - ambient_temp);
+    bed.update_model();
+    finish();
+
+    SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_FINISHED);
+    SERIAL_ECHOLNPGM("MPC_BED_HEAT_CAPACITY ", mpc.block_heat_capacity);
+    SERIAL_ECHOLNPGM("MPC_BED_SENSOR_RESPONSIVENESS ", p_float_t(mpc.sensor_responsiveness, 4));
+    SERIAL_ECHOLNPGM("MPC_BED_AMBIENT_XFER_COEFF ", p_float_t(mpc.ambient_xfer_coeff, 4));
+  }
+
+#endif // MPC_BED_AUTOTUNE
+
 int16_t Temperature::getHeaterPower(const heater_id_t heater_id) {
   switch (heater_id) {
     #if HAS_HEATED_BED
@@ -1841,7 +2003,72 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
     return pid_output;
   }
 
-#endif // PIDTEMPBED
+#elif ENABLED(MPCTEMPBED)
+
+  /**
+   * Refresh the precomputed bed model terms from the MPC constants.
+   * Call whenever heater_power, block_heat_capacity, sensor_responsiveness
+   * or ambient_xfer_coeff are changed.
+   */
+  void MPCBedHeaterInfo::update_model() {
+    const float A = _MAX(mpc.ambient_xfer_coeff, 0.0001f),
+                C = _MAX(mpc.block_heat_capacity, 0.01f);
+    block_decay   = exp(-A * (MPC_dT) / C);
+    power_gain    = (1.0f - block_decay) / A;
+    sensor_decay  = exp(-mpc.sensor_responsiveness * (MPC_dT));
+    horizon_decay = exp(-A * (MPC_BED_HORIZON) / C);
+    horizon_gain  = A / (1.0f - horizon_decay);
+  }
+
+  /**
+   * MPC Output Bed
+   * @brief Calculate the bed power output using the predictive model
+   *        that is required to reach the target within MPC_BED_HORIZON.
+   * @return The power output for the bed
+   */
+  float Temperature::get_pid_output_bed() {
+    MPCBedHeaterInfo &bed = temp_bed;
+    const MPCBed_t &mpc = bed.mpc;
+
+    // At startup, initialize modeled temperatures
+    if (isnan(bed.modeled_block_temp)) {
+      bed.modeled_ambient_temp = _MIN(30.0f, bed.celsius);   // Cap initial value at reasonable max room temperature of 30C
+      bed.modeled_block_temp = bed.modeled_sensor_temp = bed.celsius;
+    }
+
+    // Step the model with the power applied over the last sample period
+    const float last_power = bed.soft_pwm_amount * mpc.heater_power * RECIPROCAL(127),
+                last_block_temp = bed.modeled_block_temp;
+    bed.modeled_block_temp = bed.modeled_ambient_temp + (bed.modeled_block_temp - bed.modeled_ambient_temp) * bed.block_decay
+                           + last_power * bed.power_gain;
+    const float blocktempdelta = bed.modeled_block_temp - last_block_temp;
+    bed.modeled_sensor_temp = bed.modeled_block_temp + (bed.modeled_sensor_temp - bed.modeled_block_temp) * bed.sensor_decay;
+
+    // Slowly correct towards the measured temperature so noise averages out
+    const float delta_to_apply = (bed.celsius - bed.modeled_sensor_temp) * (MPC_BED_SMOOTHING_FACTOR);
+    bed.modeled_block_temp += delta_to_apply;
+    bed.modeled_sensor_temp += delta_to_apply;
+
+    // Only correct ambient when close to steady state (output power is not clipped or asymptotic temperature is reached)
+    if (WITHIN(bed.soft_pwm_amount, 1, (MAX_BED_POWER >> 1) - 1) || fabs(blocktempdelta + delta_to_apply) < (MPC_BED_STEADYSTATE * MPC_dT))
+      bed.modeled_ambient_temp += delta_to_apply > 0.f ? _MAX(delta_to_apply, MPC_BED_MIN_AMBIENT_CHANGE * MPC_dT) : _MIN(delta_to_apply, -MPC_BED_MIN_AMBIENT_CHANGE * MPC_dT);
+
+    const bool is_idling = TERN0(HEATER_IDLE_HANDLER, heater_idle[IDLE_INDEX_BED].timed_out);
+
+    float power = 0.0f;
+    if (bed.target != 0 && !is_idling) {
+      // Power that brings the block to the target at the end of the horizon
+      const float ambient = bed.modeled_ambient_temp;
+      power = bed.horizon_gain * (bed.target - ambient - (bed.modeled_block_temp - ambient) * bed.horizon_decay);
+    }
+
+    float pid_output = power * 254.0f / mpc.heater_power + 1.0f;      // Ensure correct quantization into a range of 0 to 127
+    LIMIT(pid_output, 0, MAX_BED_POWER);
+
+    return pid_output;
+  }
+
+#endif // MPCTEMPBED
 
 #if ENABLED(PIDTEMPCHAMBER)
 
@@ -1955,7 +2182,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
 
     do { // 'break' out of this block
 
-      #if DISABLED(PIDTEMPBED)
+      #if NONE(PIDTEMPBED, MPCTEMPBED)
         if (PENDING(ms, next_bed_check_ms)
           && TERN1(PAUSE_CHANGE_REQD, paused_for_probing == last_pause_state)
         ) break;
@@ -1973,7 +2200,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
         const bool bed_timed_out = heater_idle[IDLE_INDEX_BED].timed_out;
         if (bed_timed_out) {
           temp_bed.soft_pwm_amount = 0;
-          if (DISABLED(PIDTEMPBED)) WRITE_HEATER_BED(LOW);
+          if (NONE(PIDTEMPBED, MPCTEMPBED)) WRITE_HEATER_BED(LOW);
         }
       #else
         constexpr bool bed_timed_out = false;
@@ -1986,14 +2213,14 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
         break;
       }
 
-      #if ENABLED(PIDTEMPBED)
+      #if ANY(PIDTEMPBED, MPCTEMPBED)
 
         //
-        // PID Bed Heating
+        // PID / MPC Bed Heating
         //
         temp_bed.soft_pwm_amount = WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP) ? (int)get_pid_output_bed() >> 1 : 0;
 
-      #else // !PIDTEMPBED
+      #else // !PIDTEMPBED && !MPCTEMPBED
 
         //
         // Range-limited "bang-bang" bed heating
@@ -2035,7 +2262,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
 
         #endif // !PELTIER_BED
 
-      #endif // !PIDTEMPBED
+      #endif // !PIDTEMPBED && !MPCTEMPBED
 
     } while (false);
   }
@@ -3021,6 +3248,8 @@ void Temperature::init() {
     HOTEND_LOOP() temp_hotend[e].modeled_block_temp = NAN;
   #endif
 
+  TERN_(MPCTEMPBED, temp_bed.modeled_block_temp = NAN);
+
   #if HAS_HEATER_0
     #ifdef BOARD_OPENDRAIN_MOSFETS
       OUT_WRITE_OD(HEATER_0_PIN, ENABLED(HEATER_0_INVERTING));
@@ -4301,6 +4530,10 @@ void Temperature::isr() {
    * On the next pass, the ADC value is read and accumulated.
    *
    * This gives each ADC 0.9765ms to charge up.
+   *
+   * With TEMP_ADC_BATCH_SAMPLING the HAL converts all channels in the
+   * background (DMA / burst mode) so all sensors are accumulated in a
+   * single pass, leaving the remaining ISR loops free of ADC work.
    */
   #define ACCUMULATE_ADC(obj) do{ \
     if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; \
@@ -4342,80 +4575,124 @@ void Temperature::isr() {
       }
       break;
 
-    #if HAS_TEMP_ADC_0
-      case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
-      case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
-    #endif
+    #if ENABLED(TEMP_ADC_BATCH_SAMPLING)
+
+      case MeasureTemp_ALL:
+        // Every channel is converted in the background, so take them all in one pass
+        #define ACCUMULATE_ADC_PIN(obj, PIN) obj.sample(hal.adc_read(PIN))
+        TERN_(HAS_TEMP_ADC_0,         ACCUMULATE_ADC_PIN(temp_hotend[0], TEMP_0_PIN));
+        TERN_(HAS_TEMP_ADC_BED,       ACCUMULATE_ADC_PIN(temp_bed, TEMP_BED_PIN));
+        TERN_(HAS_TEMP_ADC_CHAMBER,   ACCUMULATE_ADC_PIN(temp_chamber, TEMP_CHAMBER_PIN));
+        TERN_(HAS_TEMP_ADC_COOLER,    ACCUMULATE_ADC_PIN(temp_cooler, TEMP_COOLER_PIN));
+        TERN_(HAS_TEMP_ADC_PROBE,     ACCUMULATE_ADC_PIN(temp_probe, TEMP_PROBE_PIN));
+        TERN_(HAS_TEMP_ADC_BOARD,     ACCUMULATE_ADC_PIN(temp_board, TEMP_BOARD_PIN));
+        TERN_(HAS_TEMP_ADC_SOC,       ACCUMULATE_ADC_PIN(temp_soc, TEMP_SOC_PIN));
+        TERN_(HAS_TEMP_ADC_REDUNDANT, ACCUMULATE_ADC_PIN(temp_redundant, TEMP_REDUNDANT_PIN));
+        TERN_(HAS_TEMP_ADC_1,         ACCUMULATE_ADC_PIN(temp_hotend[1], TEMP_1_PIN));
+        TERN_(HAS_TEMP_ADC_2,         ACCUMULATE_ADC_PIN(temp_hotend[2], TEMP_2_PIN));
+        TERN_(HAS_TEMP_ADC_3,         ACCUMULATE_ADC_PIN(temp_hotend[3], TEMP_3_PIN));
+        TERN_(HAS_TEMP_ADC_4,         ACCUMULATE_ADC_PIN(temp_hotend[4], TEMP_4_PIN));
+        TERN_(HAS_TEMP_ADC_5,         ACCUMULATE_ADC_PIN(temp_hotend[5], TEMP_5_PIN));
+        TERN_(HAS_TEMP_ADC_6,         ACCUMULATE_ADC_PIN(temp_hotend[6], TEMP_6_PIN));
+        TERN_(HAS_TEMP_ADC_7,         ACCUMULATE_ADC_PIN(temp_hotend[7], TEMP_7_PIN));
+        TERN_(HAS_JOY_ADC_X,          ACCUMULATE_ADC_PIN(joystick.x, JOY_X_PIN));
+        TERN_(HAS_JOY_ADC_Y,          ACCUMULATE_ADC_PIN(joystick.y, JOY_Y_PIN));
+        TERN_(HAS_JOY_ADC_Z,          ACCUMULATE_ADC_PIN(joystick.z, JOY_Z_PIN));
+        break;
 
-    #if HAS_TEMP_ADC_BED
-      case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
-      case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
-    #endif
+    #else
 
-    #if HAS_TEMP_ADC_CHAMBER
-      case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
-      case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
-    #endif
+      #if HAS_TEMP_ADC_0
+        case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
+        case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_COOLER
-      case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
-      case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
-    #endif
+      #if HAS_TEMP_ADC_BED
+        case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
+        case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
+      #endif
 
-    #if HAS_TEMP_ADC_PROBE
-      case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
-      case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
-    #endif
+      #if HAS_TEMP_ADC_CHAMBER
+        case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
+        case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
+      #endif
 
-    #if HAS_TEMP_ADC_BOARD
-      case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
-      case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
-    #endif
+      #if HAS_TEMP_ADC_COOLER
+        case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
+        case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
+      #endif
 
-    #if HAS_TEMP_ADC_SOC
-      case PrepareTemp_SOC: hal.adc_start(TEMP_SOC_PIN); break;
-      case MeasureTemp_SOC: ACCUMULATE_ADC(temp_soc); break;
-    #endif
+      #if HAS_TEMP_ADC_PROBE
+        case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
+        case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
+      #endif
 
-    #if HAS_TEMP_ADC_REDUNDANT
-      case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
-      case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
-    #endif
+      #if HAS_TEMP_ADC_BOARD
+        case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
+        case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
+      #endif
 
-    #if HAS_TEMP_ADC_1
-      case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
-      case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
-    #endif
+      #if HAS_TEMP_ADC_SOC
+        case PrepareTemp_SOC: hal.adc_start(TEMP_SOC_PIN); break;
+        case MeasureTemp_SOC: ACCUMULATE_ADC(temp_soc); break;
+      #endif
 
-    #if HAS_TEMP_ADC_2
-      case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
-      case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
-    #endif
+      #if HAS_TEMP_ADC_REDUNDANT
+        case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
+        case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
+      #endif
 
-    #if HAS_TEMP_ADC_3
-      case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
-      case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
-    #endif
+      #if HAS_TEMP_ADC_1
+        case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
+        case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_4
-      case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
-      case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
-    #endif
+      #if HAS_TEMP_ADC_2
+        case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
+        case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_5
-      case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
-      case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
-    #endif
+      #if HAS_TEMP_ADC_3
+        case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
+        case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_6
-      case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
-      case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
-    #endif
+      #if HAS_TEMP_ADC_4
+        case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
+        case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_7
-      case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
-      case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
-    #endif
+      #if HAS_TEMP_ADC_5
+        case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
+        case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
+      #endif
+
+      #if HAS_TEMP_ADC_6
+        case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
+        case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
+      #endif
+
+      #if HAS_TEMP_ADC_7
+        case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
+        case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
+      #endif
+
+      #if HAS_JOY_ADC_X
+        case PrepareJoy_X: hal.adc_start(JOY_X_PIN); break;
+        case MeasureJoy_X: ACCUMULATE_ADC(joystick.x); break;
+      #endif
+
+      #if HAS_JOY_ADC_Y
+        case PrepareJoy_Y: hal.adc_start(JOY_Y_PIN); break;
+        case MeasureJoy_Y: ACCUMULATE_ADC(joystick.y); break;
+      #endif
+
+      #if HAS_JOY_ADC_Z
+        case PrepareJoy_Z: hal.adc_start(JOY_Z_PIN); break;
+        case MeasureJoy_Z: ACCUMULATE_ADC(joystick.z); break;
+      #endif
+
+    #endif // !TEMP_ADC_BATCH_SAMPLING
 
     #if ENABLED(FILAMENT_WIDTH_SENSOR)
       case Prepare_FILWIDTH: hal.adc_start(FILWIDTH_PIN); break;
@@ -4445,21 +4722,6 @@ void Temperature::isr() {
         break;
     #endif
 
-    #if HAS_JOY_ADC_X
-      case PrepareJoy_X: hal.adc_start(JOY_X_PIN); break;
-      case MeasureJoy_X: ACCUMULATE_ADC(joystick.x); break;
-    #endif
-
-    #if HAS_JOY_ADC_Y
-      case PrepareJoy_Y: hal.adc_start(JOY_Y_PIN); break;
-      case MeasureJoy_Y: ACCUMULATE_ADC(joystick.y); break;
-    #endif
-
-    #if HAS_JOY_ADC_Z
-      case PrepareJoy_Z: hal.adc_start(JOY_Z_PIN); break;
-      case MeasureJoy_Z: ACCUMULATE_ADC(joystick.z); break;
-    #endif
-
     #if HAS_ADC_BUTTONS
       #ifndef ADC_BUTTON_DEBOUNCE_DELAY
         #define ADC_BUTTON_DEBOUNCE_DELAY 16
@@ -4503,6 +4765,12 @@ void Temperature::isr() {
   // Poll endstops state, if required
   endstops.poll();
 
+  // Sample stepper positions for M156 T
+  TERN_(POSITION_TELEMETRY, position_telemetry.sample());
+
+  // Time the M240 light strobe
+  TERN_(PHOTO_STROBE, photo_strobe.isr());
+
   // Periodically call the planner timer service routine
   planner.isr();
 }
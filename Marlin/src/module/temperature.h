@@ -64,59 +64,63 @@ typedef int_fast8_t heater_id_t;
  */
 enum ADCSensorState : char {
   StartSampling,
-  #if HAS_TEMP_ADC_0
-    PrepareTemp_0, MeasureTemp_0,
-  #endif
-  #if HAS_TEMP_ADC_BED
-    PrepareTemp_BED, MeasureTemp_BED,
-  #endif
-  #if HAS_TEMP_ADC_CHAMBER
-    PrepareTemp_CHAMBER, MeasureTemp_CHAMBER,
-  #endif
-  #if HAS_TEMP_ADC_COOLER
-    PrepareTemp_COOLER, MeasureTemp_COOLER,
-  #endif
-  #if HAS_TEMP_ADC_PROBE
-    PrepareTemp_PROBE, MeasureTemp_PROBE,
-  #endif
-  #if HAS_TEMP_ADC_BOARD
-    PrepareTemp_BOARD, MeasureTemp_BOARD,
-  #endif
-  #if HAS_TEMP_ADC_SOC
-    PrepareTemp_SOC, MeasureTemp_SOC,
-  #endif
-  #if HAS_TEMP_ADC_REDUNDANT
-    PrepareTemp_REDUNDANT, MeasureTemp_REDUNDANT,
-  #endif
-  #if HAS_TEMP_ADC_1
-    PrepareTemp_1, MeasureTemp_1,
-  #endif
-  #if HAS_TEMP_ADC_2
-    PrepareTemp_2, MeasureTemp_2,
-  #endif
-  #if HAS_TEMP_ADC_3
-    PrepareTemp_3, MeasureTemp_3,
-  #endif
-  #if HAS_TEMP_ADC_4
-    PrepareTemp_4, MeasureTemp_4,
-  #endif
-  #if HAS_TEMP_ADC_5
-    PrepareTemp_5, MeasureTemp_5,
-  #endif
-  #if HAS_TEMP_ADC_6
-    PrepareTemp_6, MeasureTemp_6,
-  #endif
-  #if HAS_TEMP_ADC_7
-    PrepareTemp_7, MeasureTemp_7,
-  #endif
-  #if HAS_JOY_ADC_X
-    PrepareJoy_X, MeasureJoy_X,
-  #endif
-  #if HAS_JOY_ADC_Y
-    PrepareJoy_Y, MeasureJoy_Y,
-  #endif
-  #if HAS_JOY_ADC_Z
-    PrepareJoy_Z, MeasureJoy_Z,
+  #if ENABLED(TEMP_ADC_BATCH_SAMPLING)
+    MeasureTemp_ALL, // Accumulate all continuously-converted sensors at once
+  #else
+    #if HAS_TEMP_ADC_0
+      PrepareTemp_0, MeasureTemp_0,
+    #endif
+    #if HAS_TEMP_ADC_BED
+      PrepareTemp_BED, MeasureTemp_BED,
+    #endif
+    #if HAS_TEMP_ADC_CHAMBER
+      PrepareTemp_CHAMBER, MeasureTemp_CHAMBER,
+    #endif
+    #if HAS_TEMP_ADC_COOLER
+      PrepareTemp_COOLER, MeasureTemp_COOLER,
+    #endif
+    #if HAS_TEMP_ADC_PROBE
+      PrepareTemp_PROBE, MeasureTemp_PROBE,
+    #endif
+    #if HAS_TEMP_ADC_BOARD
+      PrepareTemp_BOARD, MeasureTemp_BOARD,
+    #endif
+    #if HAS_TEMP_ADC_SOC
+      PrepareTemp_SOC, MeasureTemp_SOC,
+    #endif
+    #if HAS_TEMP_ADC_REDUNDANT
+      PrepareTemp_REDUNDANT, MeasureTemp_REDUNDANT,
+    #endif
+    #if HAS_TEMP_ADC_1
+      PrepareTemp_1, MeasureTemp_1,
+    #endif
+    #if HAS_TEMP_ADC_2
+      PrepareTemp_2, MeasureTemp_2,
+    #endif
+    #if HAS_TEMP_ADC_3
+      PrepareTemp_3, MeasureTemp_3,
+    #endif
+    #if HAS_TEMP_ADC_4
+      PrepareTemp_4, MeasureTemp_4,
+    #endif
+    #if HAS_TEMP_ADC_5
+      PrepareTemp_5, MeasureTemp_5,
+    #endif
+    #if HAS_TEMP_ADC_6
+      PrepareTemp_6, MeasureTemp_6,
+    #endif
+    #if HAS_TEMP_ADC_7
+      PrepareTemp_7, MeasureTemp_7,
+    #endif
+    #if HAS_JOY_ADC_X
+      PrepareJoy_X, MeasureJoy_X,
+    #endif
+    #if HAS_JOY_ADC_Y
+      PrepareJoy_Y, MeasureJoy_Y,
+    #endif
+    #if HAS_JOY_ADC_Z
+      PrepareJoy_Z, MeasureJoy_Z,
+    #endif
   #endif
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
     Prepare_FILWIDTH, Measure_FILWIDTH,
@@ -403,6 +407,21 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
 
 #endif
 
+#if ENABLED(MPCTEMPBED)
+
+  typedef struct MPCBed {
+    float heater_power;                 // M306 E-1 P
+    float block_heat_capacity;          // M306 E-1 C
+    float sensor_responsiveness;        // M306 E-1 R
+    float ambient_xfer_coeff;           // M306 E-1 A
+  } MPCBed_t;
+
+  #ifndef MPC_dT
+    #define MPC_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / (TEMP_TIMER_FREQUENCY))
+  #endif
+
+#endif
+
 #if ENABLED(G26_MESH_VALIDATION) && ANY(HAS_MARLINUI_MENU, EXTENSIBLE_UI)
   #define G26_CLICK_CAN_CANCEL 1
 #endif
@@ -456,6 +475,27 @@ struct PIDHeaterInfo : public HeaterInfo {
   };
 #endif
 
+#if ENABLED(MPCTEMPBED)
+  /**
+   * The bed model is stepped with its exact discrete-time solution, so the
+   * exp() terms depend only on the constants and MPC_dT. They are computed by
+   * update_model() whenever the constants change, leaving a few multiply-adds
+   * per temperature sample (cheap enough for AVR).
+   */
+  struct MPCBedHeaterInfo : public HeaterInfo {
+    MPCBed_t mpc;
+    float modeled_ambient_temp,
+          modeled_block_temp,
+          modeled_sensor_temp;
+    float block_decay,    // exp(-A * dT / C)          Block temperature retained per sample
+          power_gain,     // (1 - block_decay) / A     Block temperature rise per watt per sample
+          sensor_decay,   // exp(-R * dT)              Sensor lag per sample
+          horizon_decay,  // exp(-A * horizon / C)     Block temperature retained over the horizon
+          horizon_gain;   // A / (1 - horizon_decay)   Watts to close the gap within the horizon
+    void update_model();
+  };
+#endif
+
 #if ENABLED(PIDTEMP)
   typedef struct PIDHeaterInfo<hotend_pid_t> hotend_info_t;
 #elif ENABLED(MPCTEMP)
@@ -466,6 +506,8 @@ struct PIDHeaterInfo : public HeaterInfo {
 #if HAS_HEATED_BED
   #if ENABLED(PIDTEMPBED)
     typedef struct PIDHeaterInfo<PID_t<MIN_BED_POWER, MAX_BED_POWER>> bed_info_t;
+  #elif ENABLED(MPCTEMPBED)
+    typedef struct MPCBedHeaterInfo bed_info_t;
   #else
     typedef heater_info_t bed_info_t;
   #endif
@@ -744,7 +786,7 @@ class Temperature {
       #if WATCH_BED
         static bed_watch_t watch_bed;
       #endif
-      #if DISABLED(PIDTEMPBED)
+      #if NONE(PIDTEMPBED, MPCTEMPBED)
         static millis_t next_bed_check_ms;
       #endif
       static temp_raw_range_t temp_sensor_range_bed;
@@ -1295,6 +1337,13 @@ class Temperature {
 
     #endif // MPC_AUTOTUNE
 
+    /**
+     * M306 E-1 MPC auto-tuning for the heated bed
+     */
+    #if ENABLED(MPC_BED_AUTOTUNE)
+      static void MPC_autotune_bed();
+    #endif
+
     #if ENABLED(PROBING_HEATERS_OFF)
       static void pause_heaters(const bool p);
     #endif
@@ -1367,7 +1416,7 @@ class Temperature {
     #if HAS_HOTEND
       static float get_pid_output_hotend(const uint8_t e);
     #endif
-    #if ENABLED(PIDTEMPBED)
+    #if ANY(PIDTEMPBED, MPCTEMPBED)
       static float get_pid_output_bed();
     #endif
     #if ENABLED(PIDTEMPCHAMBER)
@@ -680,6 +680,8 @@ void CardReader::release() {
   else
     endFilePrintNow();
 
+  TERN_(POWER_LOSS_ASYNC_WRITE, recovery.discard());
+
   flag.mounted = false;
   flag.workDirIsRoot = true;
   nrItems = -1;
@@ -1561,6 +1563,7 @@ void CardReader::fileHasFinished() {
 #if ENABLED(POWER_LOSS_RECOVERY)
 
   bool CardReader::jobRecoverFileExists() {
+    if (TERN0(POWER_LOSS_ASYNC_WRITE, recovery.file.isOpen())) return true;
     const bool exists = recovery.file.open(&root, recovery.filename, O_READ);
     if (exists) recovery.file.close();
     return exists;
@@ -1569,7 +1572,7 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : TERN(POWER_LOSS_ASYNC_WRITE, O_CREAT | O_WRITE, O_CREAT | O_WRITE | O_TRUNC | O_SYNC)))
       openFailed(recovery.filename);
     else if (!read)
       echo_write_to_file(recovery.filename);
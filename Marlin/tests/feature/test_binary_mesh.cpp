@@ -0,0 +1,114 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ALL(BINARY_MESH, HAS_MEDIA)
+
+#include <src/MarlinCore.h>
+#include <src/feature/bedlevel/bedlevel.h>
+#include <src/gcode/gcode.h>
+#include <src/gcode/parser.h>
+
+#include "../test/ramdisk.h"
+
+// M157 calls idle() and reports to the host. Release the simulated kill button,
+// detach the host so the small serial transmit buffer can't fill, and use a RAM disk.
+struct MediaGuard {
+  MediaGuard() : saved_media(card.diskIODriver()) {
+    TERN_(HAS_KILL, WRITE(KILL_PIN, !KILL_PIN_STATE));
+    usb_serial.host_connected = false;
+    card.changeMedia(&disk);
+  }
+  ~MediaGuard() {
+    card.release();
+    card.changeMedia(saved_media);
+    usb_serial.host_connected = true;
+    usb_serial.transmit_buffer.clear();
+  }
+  RamDisk disk;
+  DiskIODriver * const saved_media;
+};
+
+static void run_gcode(const char * const cmd) {
+  char command[MAX_CMD_SIZE];
+  strcpy(command, cmd);
+  parser.parse(command);
+  gcode.process_parsed_command(true);
+}
+
+MARLIN_TEST(binary_mesh, z_to_um) {
+  TEST_ASSERT_EQUAL(0, mesh_z_to_um(0.0f));
+  TEST_ASSERT_EQUAL(-1235, mesh_z_to_um(-1.2346f));
+  TEST_ASSERT_EQUAL(1235, mesh_z_to_um(1.2346f));
+  TEST_ASSERT_EQUAL(MESH_UM_NAN, mesh_z_to_um(NAN));
+  TEST_ASSERT_TRUE(isnan(mesh_um_to_z(MESH_UM_NAN)));
+
+  // Out of range values saturate. They must never read back as unprobed.
+  TEST_ASSERT_EQUAL(32766, mesh_z_to_um(MESH_UM_MAX_Z));
+  TEST_ASSERT_EQUAL(32766, mesh_z_to_um(40.0f));
+  TEST_ASSERT_EQUAL(-32766, mesh_z_to_um(-40.0f));
+  TEST_ASSERT_EQUAL(32766, mesh_z_to_um(1e9f));
+  TEST_ASSERT_FLOAT_WITHIN(0.0005f, 32.766f, mesh_um_to_z(mesh_z_to_um(100.0f)));
+}
+
+MARLIN_TEST(binary_mesh, save_load_round_trip) {
+  const MediaGuard guard;
+
+  // Expected values after a save and load, with 1µm resolution
+  bed_mesh_t expected;
+  GRID_LOOP(x, y) {
+    float z = (x * 37 - y * 53) * 0.0123f;
+    if (x == 1 && y == 2) z = NAN;
+    if (x == 2 && y == 1) z = 40.0f;
+    if (x == 0 && y == 0) z = -1.2345f;
+    if (x == GRID_MAX_POINTS_X - 1 && y == 0) z = -33.0f;
+    bedlevel.z_values[x][y] = z;
+    expected[x][y] = mesh_um_to_z(mesh_z_to_um(z));
+  }
+
+  card.mount();
+  TEST_ASSERT_TRUE(card.isMounted());
+  run_gcode("M157 S");
+
+  GRID_LOOP(x, y) bedlevel.z_values[x][y] = 0;
+  run_gcode("M157 L");
+
+  GRID_LOOP(x, y) {
+    if (isnan(expected[x][y]))
+      TEST_ASSERT_TRUE(isnan(bedlevel.z_values[x][y]));
+    else
+      TEST_ASSERT_FLOAT_WITHIN(0.0005f, expected[x][y], bedlevel.z_values[x][y]);
+  }
+  TEST_ASSERT_FLOAT_WITHIN(0.0005f, 32.766f, bedlevel.z_values[2][1]);
+  TEST_ASSERT_FLOAT_WITHIN(0.0005f, -32.766f, bedlevel.z_values[GRID_MAX_POINTS_X - 1][0]);
+
+  // A corrupt file is rejected and leaves the mesh alone
+  card.openFileWrite(BINARY_MESH_FILE);
+  uint8_t junk[] = { 0xB5, 0x4D, 0x01, 0x00 };
+  card.write(junk, sizeof(junk));
+  card.closefile();
+  run_gcode("M157 L");
+  TEST_ASSERT_FLOAT_WITHIN(0.0005f, 32.766f, bedlevel.z_values[2][1]);
+}
+
+#endif
@@ -0,0 +1,390 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(BINARY_FILE_TRANSFER)
+
+#include <src/sd/cardreader.h>
+#include <src/feature/binary_stream.h>
+
+#include "../test/ramdisk.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <time.h>
+
+/**
+ * Loopback harness for the binary file transfer protocol.
+ *
+ * The test plays the host side of buildroot/share/scripts/MarlinBinaryProtocol.py
+ * over the simulated usb_serial ring buffers. The ring buffers aren't thread-safe,
+ * so whenever the host waits it polls the device on the same thread, calling
+ * BinaryStream::receive() the way GCodeQueue::get_serial_commands() does.
+ * The simulator has no SD card, so a FAT16 RAM disk stands in for it. Uploads
+ * go through card.write() and the decode buffers, and are read back to compare.
+ */
+
+typedef std::vector<uint8_t> bytes_t;
+typedef std::chrono::steady_clock test_clock;
+
+static double cpu_us() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+// The firmware side of the stream, with a RAM disk for media
+class LoopbackDevice {
+public:
+  LoopbackDevice() : saved_media(card.diskIODriver()) {
+    card.changeMedia(&disk);
+    usb_serial.receive_buffer.clear();
+    usb_serial.transmit_buffer.clear();
+  }
+  ~LoopbackDevice() {
+    card.release();
+    card.changeMedia(saved_media);
+  }
+
+  // One pass of the firmware main loop over the stream
+  void poll() {
+    // Only count CPU time spent on pending data, not the idle polling
+    const bool busy = usb_serial.available();
+    const double t0 = busy ? cpu_us() : 0;
+    binaryStream[0].receive(line_buffer);
+    if (busy) receive_us += cpu_us() - t0;
+  }
+
+  // Read a whole file back from the RAM disk. Call once the transfer is closed.
+  bytes_t read_file(const char * const filename) {
+    bytes_t data;
+    usb_serial.transmit_buffer.clear();  // Leave room for the mount and open messages
+    card.mount();
+    card.openFileRead(filename);
+    if (card.isFileOpen()) {
+      uint8_t block[512];
+      int16_t n;
+      while ((n = card.read(block, sizeof(block))) > 0) data.insert(data.end(), block, block + n);
+      card.closefile();
+    }
+    card.release();
+    usb_serial.transmit_buffer.clear();
+    return data;
+  }
+
+  double receive_us = 0;
+
+private:
+  RamDisk disk;
+  DiskIODriver * const saved_media;
+  char line_buffer[MAX_CMD_SIZE];
+};
+
+// The host side of MarlinBinaryProtocol.py
+class LoopbackHost {
+public:
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class FileTransfer : uint8_t { QUERY, OPEN, CLOSE, WRITE, ABORT };
+
+  LoopbackHost(LoopbackDevice &device) : device(device) {}
+
+  uint8_t sync = 0;
+  uint16_t block_size = 0;
+  uint32_t packets = 0, retransmits = 0, corrupt_every = 0;
+
+  bool connect() {
+    transmit(build_packet(0, 1));   // CONTROL SYNC
+    std::string line;
+    while (read_line(line))
+      if (line.rfind("ss", 0) == 0) {
+        unsigned s, b;
+        if (sscanf(line.c_str(), "ss%u,%u", &s, &b) != 2) return false;
+        sync = s;
+        block_size = b;
+        return true;
+      }
+    return false;
+  }
+
+  bool send(const Protocol protocol, const uint8_t type, const bytes_t &data={}) {
+    const bytes_t packet = build_packet(uint8_t(protocol), type, data);
+    for (uint8_t attempt = 0; attempt < 5; ++attempt) {
+      bytes_t wire = packet;
+      // Corrupt the payload of every Nth packet on the first attempt
+      if (attempt == 0 && data.size() && corrupt_every && (packets % corrupt_every) == corrupt_every - 1)
+        wire[8] ^= 0x5A;
+      transmit(wire);
+      switch (await_response()) {
+        case Response::OK: ++packets; ++sync; return true;
+        case Response::RESEND: ++retransmits; break;
+        case Response::FAIL: return false;
+      }
+    }
+    return false;
+  }
+
+  std::string await_pft() {
+    std::string line;
+    while (read_line(line)) if (line.rfind("PFT:", 0) == 0) return line;
+    return "timeout";
+  }
+
+  bool open(const char * const filename, const uint8_t compression=0) {
+    bytes_t data = { 0, compression };  // A real transfer, written to the media
+    data.insert(data.end(), filename, filename + strlen(filename) + 1);
+    return send(Protocol::FILE_TRANSFER, uint8_t(FileTransfer::OPEN), data) && await_pft() == "PFT:success";
+  }
+
+  bool write(const bytes_t &data) {
+    for (size_t i = 0; i < data.size(); i += block_size) {
+      const bytes_t block(data.begin() + i, data.begin() + _MIN(data.size(), i + block_size));
+      if (!send(Protocol::FILE_TRANSFER, uint8_t(FileTransfer::WRITE), block)) return false;
+    }
+    return true;
+  }
+
+  bool close() {
+    return send(Protocol::FILE_TRANSFER, uint8_t(FileTransfer::CLOSE)) && await_pft() == "PFT:success";
+  }
+
+private:
+  enum class Response : uint8_t { OK, RESEND, FAIL };
+
+  LoopbackDevice &device;
+  std::string rx_text;
+
+  // fletchers 16 checksum
+  static uint16_t checksum(const uint16_t cs, const uint8_t value) {
+    const uint16_t cs_low = ((cs & 0xFF) + value) % 255;
+    return ((((cs >> 8) + cs_low) % 255) << 8) | cs_low;
+  }
+
+  static uint16_t build_checksum(const bytes_t &buffer, const size_t from) {
+    uint16_t cs = 0;
+    for (size_t i = from; i < buffer.size(); ++i) cs = checksum(cs, buffer[i]);
+    return cs;
+  }
+
+  static void pack_int16(bytes_t &buffer, const uint16_t value) {
+    buffer.push_back(value & 0xFF);
+    buffer.push_back(value >> 8);
+  }
+
+  bytes_t build_packet(const uint8_t protocol, const uint8_t type, const bytes_t &data={}) const {
+    bytes_t packet;
+    pack_int16(packet, 0xB5AD);                     // start token, not included in checksum
+    packet.push_back(sync);
+    packet.push_back((protocol << 4) | (type & 0xF));
+    pack_int16(packet, data.size());
+    pack_int16(packet, build_checksum(packet, 2));  // header checksum
+    if (data.size()) {
+      packet.insert(packet.end(), data.begin(), data.end());
+      pack_int16(packet, build_checksum(packet, 2));
+    }
+    return packet;
+  }
+
+  // Move device output into rx_text, so the device never blocks on a full TX buffer
+  void pump() {
+    while (usb_serial.transmit_buffer.available()) rx_text += char(usb_serial.transmit_buffer.read());
+  }
+
+  // Let the device run while the host waits
+  void wait() { pump(); device.poll(); }
+
+  void transmit(const bytes_t &packet) {
+    for (const uint8_t b : packet) {
+      while (!usb_serial.receive_buffer.free()) wait();
+      usb_serial.receive_buffer.write(b);
+    }
+  }
+
+  bool read_line(std::string &line, const uint16_t timeout_ms=2000) {
+    const auto deadline = test_clock::now() + std::chrono::milliseconds(timeout_ms);
+    for (;;) {
+      pump();
+      const size_t eol = rx_text.find('\n');
+      if (eol != std::string::npos) {
+        line = rx_text.substr(0, eol);
+        rx_text.erase(0, eol + 1);
+        return true;
+      }
+      if (test_clock::now() > deadline) return false;
+      wait();
+    }
+  }
+
+  Response await_response() {
+    std::string line;
+    while (read_line(line)) {
+      if (line.rfind("ok", 0) == 0 && uint8_t(atoi(line.c_str() + 2)) == sync) return Response::OK;
+      if (line.rfind("rs", 0) == 0) return Response::RESEND;
+      if (line.rfind("fe", 0) == 0) return Response::FAIL;
+    }
+    return Response::FAIL;
+  }
+};
+
+// G-code-like payload with some repetition for the compression tests
+static bytes_t test_payload(const size_t size) {
+  bytes_t data;
+  char line[48];
+  for (uint32_t i = 0; data.size() < size; ++i) {
+    const int n = snprintf(line, sizeof(line), "G1 X%u.%03u Y%u.%03u E%u.00000\n", 10 + i % 200, i % 997, 20 + i % 180, (i * 7) % 991, i / 100);
+    data.insert(data.end(), line, line + n);
+  }
+  data.resize(size);
+  return data;
+}
+
+// Minimal heatshrink encoder: literals plus backreferences for runs of the previous bytes
+static bytes_t heatshrink_encode(const bytes_t &in, const uint8_t window_bits, const uint8_t lookahead_bits) {
+  bytes_t out;
+  uint8_t cur = 0, nbits = 0;
+  auto put = [&](const uint16_t value, uint8_t count) {
+    while (count--) {
+      cur = (cur << 1) | ((value >> count) & 1);
+      if (++nbits == 8) { out.push_back(cur); cur = nbits = 0; }
+    }
+  };
+  const size_t window = 1UL << window_bits, max_count = 1UL << lookahead_bits;
+  for (size_t i = 0; i < in.size();) {
+    // Find the longest match for the bytes at i within the window
+    size_t best_len = 0, best_dist = 0;
+    for (size_t dist = 1; dist <= _MIN(i, window); ++dist) {
+      size_t len = 0;
+      while (len < max_count && i + len < in.size() && in[i + len] == in[i + len - dist]) ++len;
+      if (len > best_len) { best_len = len; best_dist = dist; }
+    }
+    if (best_len > 2) {
+      put(0, 1);
+      put(best_dist - 1, window_bits);
+      put(best_len - 1, lookahead_bits);
+      i += best_len;
+    }
+    else {
+      put(1, 1);
+      put(in[i++], 8);
+    }
+  }
+  if (nbits) out.push_back(cur << (8 - nbits));
+  return out;
+}
+
+// Report the transfer rate and return it in KB/s
+static double report(const char * const name, const size_t bytes, const test_clock::time_point t0, const LoopbackHost &host, const LoopbackDevice &device) {
+  const double secs = std::chrono::duration<double>(test_clock::now() - t0).count(), kb = bytes / 1024.0;
+  char msg[160];
+  snprintf(msg, sizeof(msg), "%s: %.0f KB/s, %u packets, %u retransmits, %.1f us device CPU/KB",
+    name, kb / secs, unsigned(host.packets), unsigned(host.retransmits), device.receive_us / kb);
+  TEST_MESSAGE(msg);
+  return kb / secs;
+}
+
+// Far below a native host, but a stall in receive() (e.g., waiting out
+// rx_timeslice on every packet) drops the rate well under this.
+constexpr double min_kb_s = 200;
+
+MARLIN_TEST(binary_stream, sync_and_query) {
+  LoopbackDevice device;
+  LoopbackHost host(device);
+  TEST_ASSERT_TRUE(host.connect());
+  TEST_ASSERT_EQUAL(MAX_CMD_SIZE, host.block_size);
+  TEST_ASSERT_TRUE(host.send(LoopbackHost::Protocol::FILE_TRANSFER, uint8_t(LoopbackHost::FileTransfer::QUERY)));
+  TEST_ASSERT_EQUAL_STRING("PFT:version:0.2.0:compression:heatshrink,"
+    STRINGIFY(BINARY_STREAM_WINDOW_BITS) "," STRINGIFY(BINARY_STREAM_LOOKAHEAD_BITS), host.await_pft().c_str());
+}
+
+MARLIN_TEST(binary_stream, uncompressed_transfer) {
+  LoopbackDevice device;
+  LoopbackHost host(device);
+  TEST_ASSERT_TRUE(host.connect());
+
+  const bytes_t data = test_payload(64 * 1024);
+  const auto t0 = test_clock::now();
+  TEST_ASSERT_TRUE(host.open("test.gco"));
+  TEST_ASSERT_TRUE(host.write(data));
+  TEST_ASSERT_TRUE(host.close());
+  const double kb_s = report("uncompressed", data.size(), t0, host, device);
+
+  TEST_ASSERT_EQUAL(0, host.retransmits);
+  TEST_ASSERT_TRUE(kb_s > min_kb_s);
+  TEST_ASSERT_TRUE(device.read_file("test.gco") == data);
+}
+
+MARLIN_TEST(binary_stream, corrupt_packets_are_resent) {
+  LoopbackDevice device;
+  LoopbackHost host(device);
+  TEST_ASSERT_TRUE(host.connect());
+
+  const bytes_t data = test_payload(16 * 1024);
+  const auto t0 = test_clock::now();
+  TEST_ASSERT_TRUE(host.open("test.gco"));
+  host.corrupt_every = 5;
+  TEST_ASSERT_TRUE(host.write(data));
+  host.corrupt_every = 0;
+  TEST_ASSERT_TRUE(host.close());
+  report("corrupted", data.size(), t0, host, device);
+
+  // The OPEN and CLOSE packets are not corrupted
+  const uint32_t writes = host.packets - 2;
+  TEST_ASSERT_EQUAL((writes + 1) / 5, host.retransmits);
+  TEST_ASSERT_TRUE(device.read_file("test.gco") == data);
+}
+
+MARLIN_TEST(binary_stream, compressed_transfer) {
+  LoopbackDevice device;
+  LoopbackHost host(device);
+  TEST_ASSERT_TRUE(host.connect());
+
+  constexpr uint8_t wbits = BINARY_STREAM_WINDOW_BITS, lbits = _MIN(BINARY_STREAM_LOOKAHEAD_BITS, wbits - 1);
+  const bytes_t data = test_payload(64 * 1024),
+                packed = heatshrink_encode(data, wbits, lbits);
+
+  // Check the encoder against the firmware decoder before timing the transfer
+  heatshrink_decoder check;
+  TEST_ASSERT_TRUE(heatshrink_decoder_configure(&check, wbits, lbits));
+  bytes_t unpacked(data.size() + 16);
+  size_t in = 0, out = 0, count;
+  while (in < packed.size()) {
+    heatshrink_decoder_sink(&check, const_cast<uint8_t*>(&packed[in]), packed.size() - in, &count);
+    in += count;
+    while (heatshrink_decoder_poll(&check, &unpacked[out], unpacked.size() - out, &count) == HSDR_POLL_MORE) out += count;
+    out += count;
+  }
+  unpacked.resize(out);
+  TEST_ASSERT_TRUE(unpacked == data);
+
+  const auto t0 = test_clock::now();
+  TEST_ASSERT_TRUE(host.open("test.gco", 0x01 | (wbits << 4) | ((lbits - 2) << 1)));
+  TEST_ASSERT_TRUE(host.write(packed));
+  TEST_ASSERT_TRUE(host.close());
+  const double kb_s = report("heatshrink", data.size(), t0, host, device);
+
+  TEST_ASSERT_EQUAL(0, host.retransmits);
+  TEST_ASSERT_TRUE(kb_s > min_kb_s);
+  TEST_ASSERT_TRUE(device.read_file("test.gco") == data);
+}
+
+#endif
@@ -0,0 +1,374 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(AUTO_BED_LEVELING_UBL)
+
+#include <src/feature/bedlevel/bedlevel.h>
+#include <src/libs/least_squares_fit.h>
+#include <src/module/motion.h>
+#include <src/module/planner.h>
+#include <src/module/settings.h>
+#include <src/module/temperature.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Code under test calls idle(), which checks the kill button and may send host
+// keepalives. On the simulated board the kill pin reads as pressed and nothing
+// drains the small serial transmit buffer, so release the button and detach the host.
+struct IdleGuard {
+  IdleGuard() {
+    TERN_(HAS_KILL, WRITE(KILL_PIN, !KILL_PIN_STATE));
+    usb_serial.host_connected = false;
+  }
+  ~IdleGuard() { usb_serial.host_connected = true; usb_serial.transmit_buffer.clear(); }
+};
+
+// The original all-pairs fit, taking the distance for every pair of points
+static void reference_smart_fill_wlsf(bed_mesh_t &z, const float weight_factor) {
+  bed_mesh_t src;
+  memcpy(src, z, sizeof(src));
+  const float weight_scaled = weight_factor * _MAX(MESH_X_DIST, MESH_Y_DIST);
+  GRID_LOOP(ix, iy) {
+    if (!isnan(src[ix][iy])) continue;
+    const xy_pos_t ppos = { bedlevel.get_mesh_x(ix), bedlevel.get_mesh_y(iy) };
+    linear_fit_data lsf;
+    incremental_LSF_reset(&lsf);
+    GRID_LOOP(jx, jy) {
+      if (isnan(src[jx][jy])) continue;
+      const xy_pos_t rpos = { bedlevel.get_mesh_x(jx), bedlevel.get_mesh_y(jy) };
+      incremental_WLSF(&lsf, rpos, src[jx][jy], 1.0f + weight_scaled / (rpos - ppos).magnitude());
+    }
+    TEST_ASSERT_EQUAL(0, finish_incremental_LSF(&lsf));
+    z[ix][iy] = -lsf.D - lsf.A * ppos.x - lsf.B * ppos.y;
+  }
+}
+
+// A tilted and slightly warped bed, with a missing corner and scattered holes
+static void make_partial_mesh(bed_mesh_t &z) {
+  GRID_LOOP(x, y) {
+    const float mx = bedlevel.get_mesh_x(x), my = bedlevel.get_mesh_y(y);
+    const bool missing = (x < GRID_MAX_POINTS_X / 3 && y < GRID_MAX_POINTS_Y / 3) || (x + 2 * y) % 5 == 0;
+    z[x][y] = missing ? NAN : 0.002f * mx - 0.001f * my + 0.05f * sinf(mx * 0.05f) * cosf(my * 0.03f);
+  }
+}
+
+// Quantized mesh points can round either way of the float result
+constexpr float fill_tolerance = TERN(QUANTIZED_MESH, 1.1e-3f, 1e-4f);
+
+static void check_fill(const float weight_factor) {
+  bed_mesh_t expected;
+  make_partial_mesh(expected);
+  memcpy(bedlevel.z_values, expected, sizeof(expected));
+
+  reference_smart_fill_wlsf(expected, weight_factor);
+  const IdleGuard guard;
+  bedlevel.smart_fill_wlsf(weight_factor);
+
+  GRID_LOOP(x, y) {
+    TEST_ASSERT_FALSE(isnan(bedlevel.z_values[x][y]));
+    TEST_ASSERT_FLOAT_WITHIN(fill_tolerance, expected[x][y], bedlevel.z_values[x][y]);
+  }
+}
+
+MARLIN_TEST(ubl, smart_fill_wlsf_unweighted) { check_fill(0.0f); }
+MARLIN_TEST(ubl, smart_fill_wlsf_weighted_10x) { check_fill(10.0f); }
+MARLIN_TEST(ubl, smart_fill_wlsf_weighted_1000x) { check_fill(1000.0f); }
+
+struct mesh_crossing_t { xy_pos_t pos; float t, z; };
+
+// Solve for every crossed line with a divide, then interpolate Z with get_z_correction
+static uint8_t reference_crossings(const xy_pos_t &start, const xy_pos_t &end, mesh_crossing_t out[]) {
+  const xy_uint8_t istart = bedlevel.cell_indexes(start), iend = bedlevel.cell_indexes(end);
+  const xy_float_t dist = end - start;
+  uint8_t n = 0;
+  for (uint8_t i = _MIN(istart.x, iend.x) + 1; i <= _MAX(istart.x, iend.x); ++i) {
+    const float mx = bedlevel.get_mesh_x(i), t = (mx - start.x) / dist.x;
+    out[n++] = { { mx, start.y + dist.y * t }, t, 0 };
+  }
+  for (uint8_t j = _MIN(istart.y, iend.y) + 1; j <= _MAX(istart.y, iend.y); ++j) {
+    const float my = bedlevel.get_mesh_y(j), t = (my - start.y) / dist.y;
+    out[n++] = { { start.x + dist.x * t, my }, t, 0 };
+  }
+  // Order by travel, dropping the start, the end, and the second line at a corner
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < n; ++i) {
+    uint8_t m = i;
+    for (uint8_t k = i + 1; k < n; ++k) if (out[k].t < out[m].t) m = k;
+    const mesh_crossing_t c = out[m]; out[m] = out[i]; out[i] = c;
+    if (c.t > 0 && c.t < 1 && (kept == 0 || c.t > out[kept - 1].t)) {
+      out[kept] = c;
+      out[kept++].z = bedlevel.get_z_correction(c.pos);
+    }
+  }
+  return kept;
+}
+
+static uint8_t walk_crossings(const xy_pos_t &start, const xy_pos_t &end, mesh_crossing_t out[]) {
+  unified_bed_leveling::mesh_line_walker walker(start, end);
+  uint8_t n = 0;
+  while (walker.next(out[n].pos, out[n].t, out[n].z)) n++;
+  return n;
+}
+
+// A tilted and warped bed with every point probed
+static void make_full_mesh() {
+  GRID_LOOP(x, y) {
+    const float mx = bedlevel.get_mesh_x(x), my = bedlevel.get_mesh_y(y);
+    bedlevel.z_values[x][y] = 0.002f * mx - 0.001f * my + 0.05f * sinf(mx * 0.05f) * cosf(my * 0.03f);
+  }
+}
+
+// Pseudo-random moves spanning the mesh and a little beyond it
+static xy_pos_t random_point(uint32_t &seed) {
+  seed = seed * 1664525UL + 1013904223UL;
+  const float fx = (seed >> 8) * (1.0f / 16777216.0f);
+  seed = seed * 1664525UL + 1013904223UL;
+  const float fy = (seed >> 8) * (1.0f / 16777216.0f);
+  return { MESH_MIN_X - 5 + fx * (MESH_MAX_X - (MESH_MIN_X) + 10), MESH_MIN_Y - 5 + fy * (MESH_MAX_Y - (MESH_MIN_Y) + 10) };
+}
+
+static void check_walk(const xy_pos_t &start, const xy_pos_t &end) {
+  mesh_crossing_t expected[GRID_MAX_POINTS_X + GRID_MAX_POINTS_Y], actual[GRID_MAX_POINTS_X + GRID_MAX_POINTS_Y];
+  const uint8_t n = reference_crossings(start, end, expected);
+  TEST_ASSERT_EQUAL(n, walk_crossings(start, end, actual));
+  for (uint8_t i = 0; i < n; ++i) {
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, expected[i].t, actual[i].t);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, expected[i].pos.x, actual[i].pos.x);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, expected[i].pos.y, actual[i].pos.y);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, expected[i].z, actual[i].z);
+  }
+}
+
+MARLIN_TEST(ubl, mesh_line_walker_crossings) {
+  make_full_mesh();
+  const xy_pos_t lo = { MESH_MIN_X + 1, MESH_MIN_Y + 1 }, hi = { MESH_MAX_X - 1, MESH_MAX_Y - 1 },
+                 mid = { bedlevel.get_mesh_x(GRID_MAX_POINTS_X / 2), bedlevel.get_mesh_y(GRID_MAX_POINTS_Y / 2) };
+  check_walk(lo, { hi.x, hi.y - 3 });                     // Diagonal
+  check_walk({ hi.x, hi.y - 3 }, lo);                     // Reversed
+  check_walk({ lo.x, mid.y + 1 }, { hi.x, mid.y + 2 });   // Shallow
+  check_walk({ mid.x + 1, hi.y }, { mid.x - 1, lo.y });   // Steep
+  check_walk({ lo.x, mid.y + 1 }, { hi.x, mid.y + 1 });   // Horizontal
+  check_walk({ mid.x + 1, lo.y }, { mid.x + 1, hi.y });   // Vertical
+  check_walk(mid, lo);                                    // Starting on a mesh corner
+  check_walk({ MESH_MIN_X - 10, lo.y }, hi);              // Starting off the mesh
+  uint32_t seed = 1;
+  for (uint16_t i = 0; i < 500; ++i) check_walk(random_point(seed), random_point(seed));
+}
+
+// The same walk in travel order, but with a divide to find each crossing
+static uint8_t divide_crossings(const xy_pos_t &start, const xy_pos_t &end, mesh_crossing_t out[]) {
+  const xy_uint8_t istart = bedlevel.cell_indexes(start), iend = bedlevel.cell_indexes(end);
+  const xy_float_t dist = end - start;
+  const int8_t sx = iend.x < istart.x ? -1 : 1, sy = iend.y < istart.y ? -1 : 1;
+  int16_t lx = istart.x + (sx > 0), ly = istart.y + (sy > 0), cx = istart.x, cy = istart.y;
+  uint8_t nx = ABS(iend.x - istart.x), ny = ABS(iend.y - istart.y), n = 0;
+  float tx = nx ? (bedlevel.get_mesh_x(lx) - start.x) / dist.x : 2,
+        ty = ny ? (bedlevel.get_mesh_y(ly) - start.y) / dist.y : 2,
+        t_last = 0;
+  while (nx || ny) {
+    mesh_crossing_t c;
+    if (tx <= ty) {
+      c.t = tx;
+      c.pos.set(bedlevel.get_mesh_x(lx), start.y + dist.y * tx);
+      c.z = bedlevel.z_correction_for_y_on_vertical_mesh_line(c.pos.y, lx, cy);
+      cx = lx - (sx < 0);
+      lx += sx;
+      tx = --nx ? (bedlevel.get_mesh_x(lx) - start.x) / dist.x : 2;
+    }
+    else {
+      c.t = ty;
+      c.pos.set(start.x + dist.x * ty, bedlevel.get_mesh_y(ly));
+      c.z = bedlevel.z_correction_for_x_on_horizontal_mesh_line(c.pos.x, cx, ly);
+      cy = ly - (sy < 0);
+      ly += sy;
+      ty = --ny ? (bedlevel.get_mesh_y(ly) - start.y) / dist.y : 2;
+    }
+    if (c.t > t_last && c.t < 1) {
+      t_last = c.t;
+      if (isnan(c.z)) c.z = 0;
+      out[n++] = c;
+    }
+  }
+  return n;
+}
+
+// Over many random moves the walker must match a walk that divides at every crossing
+MARLIN_TEST(ubl, mesh_line_walker_matches_divide_walk) {
+  make_full_mesh();
+  constexpr uint16_t moves = 2000;
+  static xy_pos_t ends[moves + 1];
+  uint32_t seed = 42;
+  for (auto &p : ends) p = random_point(seed);
+
+  mesh_crossing_t expected[GRID_MAX_POINTS_X + GRID_MAX_POINTS_Y], actual[GRID_MAX_POINTS_X + GRID_MAX_POINTS_Y];
+  for (uint16_t i = 0; i < moves; ++i) {
+    const uint8_t n = divide_crossings(ends[i], ends[i + 1], expected);
+    TEST_ASSERT_EQUAL(n, walk_crossings(ends[i], ends[i + 1], actual));
+    for (uint8_t k = 0; k < n; ++k) {
+      TEST_ASSERT_FLOAT_WITHIN(1e-4f, expected[k].t, actual[k].t);
+      TEST_ASSERT_FLOAT_WITHIN(1e-4f, expected[k].z, actual[k].z);
+    }
+  }
+}
+
+#if ENABLED(QUANTIZED_MESH)
+
+MARLIN_TEST(ubl, quantized_mesh_z) {
+  static_assert(sizeof(bed_mesh_t) == (GRID_MAX_POINTS) * sizeof(int16_t), "QUANTIZED_MESH should store 16 bits per point.");
+  static_assert(DISABLED(OPTIMIZED_MESH_STORAGE), "QUANTIZED_MESH should replace OPTIMIZED_MESH_STORAGE.");
+
+  mesh_z_t z;
+  z = 1.2344f;  TEST_ASSERT_EQUAL(1234, z.um);
+  z = 1.2346f;  TEST_ASSERT_EQUAL(1235, z.um);
+  z = -0.0004f; TEST_ASSERT_EQUAL(0, z.um);
+  z = -1.5f;    TEST_ASSERT_FLOAT_WITHIN(1e-6f, -1.5f, float(z));
+  z += 0.25f;   TEST_ASSERT_FLOAT_WITHIN(1e-6f, -1.25f, float(z));
+  z = NAN;      TEST_ASSERT_TRUE(isnan(float(z)));
+}
+
+#endif
+
+#if ENABLED(EEPROM_SETTINGS)
+
+// Save the mesh to a storage slot and load it back, as G29 S and G29 L do
+MARLIN_TEST(ubl, mesh_store_round_trip) {
+  const IdleGuard guard;
+
+  // The simulated EEPROM is "eeprom.dat" in the working directory. Use a temporary one.
+  char cwd[256], tmpdir[] = "/tmp/marlin_ubl_XXXXXX";
+  TEST_ASSERT_TRUE(getcwd(cwd, sizeof(cwd)) != nullptr);
+  TEST_ASSERT_TRUE(mkdtemp(tmpdir) != nullptr);
+  TEST_ASSERT_EQUAL(0, chdir(tmpdir));
+
+  make_full_mesh();
+  bedlevel.z_values[0][0] = NAN;
+  bedlevel.z_values[GRID_MAX_POINTS_X - 1][0] = -3.2105f;
+  bedlevel.z_values[0][GRID_MAX_POINTS_Y - 1] = 12.3456f;
+  bed_mesh_t saved;
+  memcpy(saved, bedlevel.z_values, sizeof(saved));
+
+  const bool has_slot = settings.calc_num_meshes() > 0;
+  bed_mesh_t loaded;
+  if (has_slot) {
+    settings.store_mesh(0);
+    settings.load_mesh(0, loaded);
+  }
+
+  // Clean up before any assertion can end the test
+  remove("eeprom.dat");
+  const bool restored = chdir(cwd) == 0;
+  rmdir(tmpdir);
+  TEST_ASSERT_TRUE(restored);
+  TEST_ASSERT_TRUE(has_slot);
+
+  GRID_LOOP(x, y) {
+    if (isnan(saved[x][y]))
+      TEST_ASSERT_TRUE(isnan(loaded[x][y]));
+    else // Integer micrometers with OPTIMIZED_MESH_STORAGE or QUANTIZED_MESH
+      TEST_ASSERT_FLOAT_WITHIN(1.1e-3f, saved[x][y], loaded[x][y]);
+  }
+}
+
+#endif
+
+#if !UBL_SEGMENTED
+
+// Replay the queued blocks from the step position where they started, giving the end of each in mm
+static uint8_t planned_ends(xyze_long_t pos, xyze_pos_t out[]) {
+  uint8_t n = 0;
+  for (uint8_t i = planner.block_buffer_tail; i != planner.block_buffer_head; i = (i + 1) & (BLOCK_BUFFER_SIZE - 1)) {
+    const block_t &block = planner.block_buffer[i];
+    LOOP_LOGICAL_AXES(a) {
+      const int32_t s = block.steps[a];
+      pos[a] += block.direction_bits[a] ? s : -s;  // Set for positive motion
+      out[n][a] = pos[a] * planner.mm_per_step[a];
+    }
+    n++;
+  }
+  return n;
+}
+
+// Move with line_to_destination_cartesian and check every segment sent to the planner
+static void check_line_to_destination(const xyze_pos_t &from, const xyze_pos_t &to) {
+  planner.clear_block_buffer();
+  current_position = from;
+  planner.set_position_mm(from);
+  const xyze_long_t start_steps = planner.position;
+
+  destination = to;
+  bedlevel.line_to_destination_cartesian(feedRate_t(50), 0);
+  TEST_ASSERT_TRUE(current_position == to);
+
+  // Expect a segment ending at each crossed mesh line, then one ending at the destination
+  mesh_crossing_t crossings[GRID_MAX_POINTS_X + GRID_MAX_POINTS_Y];
+  const uint8_t nc = reference_crossings(from, to, crossings);
+  xyze_pos_t ends[BLOCK_BUFFER_SIZE];
+  TEST_ASSERT_EQUAL(nc + 1, planned_ends(start_steps, ends));
+
+  auto check_end = [](const xyze_pos_t &expected, const xyze_pos_t &actual) {
+    // Each axis lands within a step of the expected position
+    LOOP_LOGICAL_AXES(a) TEST_ASSERT_FLOAT_WITHIN(planner.mm_per_step[a] * 1.5f, expected[a], actual[a]);
+  };
+
+  const xyze_float_t total = to - from;
+  for (uint8_t i = 0; i < nc; ++i) {
+    xyze_pos_t expected = from + total * crossings[i].t;
+    expected.set(crossings[i].pos.x, crossings[i].pos.y);
+    expected.z += crossings[i].z;
+    check_end(expected, ends[i]);
+  }
+
+  xyze_pos_t expected = to;
+  expected.z += bedlevel.get_z_correction(to);
+  check_end(expected, ends[nc]);
+
+  planner.clear_block_buffer();
+}
+
+MARLIN_TEST(ubl, line_to_destination_cartesian) {
+  const IdleGuard guard;
+  settings.reset();
+  make_full_mesh();
+  TERN_(ENABLE_LEVELING_FADE_HEIGHT, set_z_fade_height(0, false));
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = true);
+
+  #define MESH_XYZE(I, DX, J, DY, Z, E) xyze_pos_t({ bedlevel.get_mesh_x(I) + (DX), bedlevel.get_mesh_y(J) + (DY), Z, E })
+  const xyze_pos_t a = MESH_XYZE(1, 3.0f, 2, 1.0f, 0.2f, 0.0f),
+                   b = MESH_XYZE(5, -2.0f, 4, 4.0f, 0.4f, 1.5f),
+                   c = MESH_XYZE(2, 1.0f, 3, 2.0f, 0.3f, 0.0f),
+                   d = MESH_XYZE(6, 1.0f, 3, 2.0f, 0.3f, 2.0f),
+                   e = MESH_XYZE(6, 3.0f, 3, 5.0f, 0.3f, 2.5f);
+  #undef MESH_XYZE
+
+  check_line_to_destination(a, b);  // Diagonal across X and Y lines, with Z and E
+  check_line_to_destination(b, a);  // Reversed
+  check_line_to_destination(c, d);  // Along a row
+  check_line_to_destination(d, e);  // Within one cell, only the final segment
+}
+
+#endif // !UBL_SEGMENTED
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2026 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if HAS_Z_STEPPER_ALIGN_STEPPER_XY
+
+#include <src/feature/z_stepper_align.h>
+
+// A flat bed tilted by 'dzdx' and 'dzdy' mm per mm
+static float plane_z(const xy_pos_t &p, const float dzdx, const float dzdy, const float z0) {
+  return z0 + dzdx * p.x + dzdy * p.y;
+}
+
+MARLIN_TEST(z_stepper_align, fit_two_steppers) {
+  // Gantry driven by steppers outside the probed span. The probe points
+  // and steppers needn't share a Y, only the X along the line between them.
+  const xy_pos_t probe_xy[] = { { 10, 100 }, { 190, 100 } },
+                 stepper_xy[] = { { -10, 150 }, { 210, 50 } };
+  const float stepper_h[] = { 0.3f, -0.2f };
+
+  // Probed heights are interpolated between the two stepper heights
+  float probe_z[2];
+  for (uint8_t i = 0; i < 2; ++i) {
+    const float t = (probe_xy[i].x - stepper_xy[0].x) / (stepper_xy[1].x - stepper_xy[0].x);
+    probe_z[i] = stepper_h[0] + t * (stepper_h[1] - stepper_h[0]);
+  }
+
+  float stepper_z[2];
+  TEST_ASSERT_TRUE(z_stepper_align.fit_stepper_z(2, probe_xy, probe_z, stepper_xy, stepper_z));
+  TEST_ASSERT_FLOAT_WITHIN(1e-5f, stepper_h[0], stepper_z[0]);
+  TEST_ASSERT_FLOAT_WITHIN(1e-5f, stepper_h[1], stepper_z[1]);
+}
+
+MARLIN_TEST(z_stepper_align, fit_three_steppers) {
+  const xy_pos_t probe_xy[] = { { 10, 10 }, { 100, 190 }, { 190, 10 } },
+                 stepper_xy[] = { { 0, 0 }, { 100, 220 }, { 220, 0 } };
+  float probe_z[3], stepper_z[3];
+  for (uint8_t i = 0; i < 3; ++i) probe_z[i] = plane_z(probe_xy[i], 0.002f, -0.003f, 0.5f);
+
+  // Three points define the plane exactly, so one correction levels the bed
+  TEST_ASSERT_TRUE(z_stepper_align.fit_stepper_z(3, probe_xy, probe_z, stepper_xy, stepper_z));
+  for (uint8_t i = 0; i < 3; ++i)
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, plane_z(stepper_xy[i], 0.002f, -0.003f, 0.5f), stepper_z[i]);
+}
+
+MARLIN_TEST(z_stepper_align, fit_four_steppers) {
+  const xy_pos_t probe_xy[] = { { 10, 10 }, { 10, 190 }, { 190, 190 }, { 190, 10 } },
+                 stepper_xy[] = { { -5, -5 }, { -5, 205 }, { 205, 205 }, { 205, -5 } };
+
+  // A twist (+e, -e, +e, -e at the corners) can't be fitted by a plane,
+  // so the least-squares fit averages it out and keeps the tilt
+  constexpr float e = 0.05f;
+  const float twist[] = { e, -e, e, -e };
+  float probe_z[4], stepper_z[4];
+  for (uint8_t i = 0; i < 4; ++i) probe_z[i] = plane_z(probe_xy[i], -0.001f, 0.004f, 1.0f) + twist[i];
+
+  TEST_ASSERT_TRUE(z_stepper_align.fit_stepper_z(4, probe_xy, probe_z, stepper_xy, stepper_z));
+  for (uint8_t i = 0; i < 4; ++i)
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, plane_z(stepper_xy[i], -0.001f, 0.004f, 1.0f), stepper_z[i]);
+}
+
+MARLIN_TEST(z_stepper_align, fit_degenerate_points) {
+  float stepper_z[3];
+
+  // Two probes at the same spot don't define a line
+  const xy_pos_t same_xy[] = { { 50, 50 }, { 50, 50 } }, stepper2_xy[] = { { 0, 50 }, { 100, 50 } };
+  const float z2[] = { 0.1f, 0.2f };
+  TEST_ASSERT_FALSE(z_stepper_align.fit_stepper_z(2, same_xy, z2, stepper2_xy, stepper_z));
+
+  // Three probes in a line don't define a plane
+  const xy_pos_t line_xy[] = { { 10, 10 }, { 100, 100 }, { 190, 190 } },
+                 stepper3_xy[] = { { 0, 0 }, { 100, 220 }, { 220, 0 } };
+  const float z3[] = { 0.1f, 0.2f, 0.3f };
+  TEST_ASSERT_FALSE(z_stepper_align.fit_stepper_z(3, line_xy, z3, stepper3_xy, stepper_z));
+}
+
+#endif
@@ -340,9 +340,22 @@ class FileTransferProtocol(object):
 
         print("File Transfer version: {0}, compression: {1}".format(self.version, self.compression['algorithm']))
 
+    # Pick the heatshrink window and lookahead, up to what the client reported
+    def negotiate_compression(self, window = None):
+        window = min(window or self.compression['window'], self.compression['window'])
+        lookahead = min(self.compression['lookahead'], window - 1, 9)
+        return window, lookahead
+
+    # Compression byte: bit 0 enables, bits 1-3 are lookahead - 2, bits 4-7 are the window.
+    # Clients before protocol 0.2 only look at bit 0 and use their own settings.
+    def compression_flags(self, compression):
+        if not compression: return 0
+        window, lookahead = compression
+        return (window << 4) | ((lookahead - 2) << 1) | 1
+
     def open(self, filename, compression, dummy):
         payload =  b'\1' if dummy else b'\0'          # dummy transfer
-        payload += b'\1' if compression else b'\0'    # payload compression
+        payload += bytes([self.compression_flags(compression)]) # payload compression
         payload += bytearray(filename, 'utf8') + b'\0'# target filename + null terminator
 
         timeout = TimeOut(5000)
@@ -388,7 +401,7 @@ class FileTransferProtocol(object):
         if token == 'PFT:success':
             print("Transfer Aborted")
 
-    def copy(self, filename, dest_filename, compression, dummy):
+    def copy(self, filename, dest_filename, compression, dummy, window = None):
         self.connect()
 
         has_heatshrink = heatshrink_exists and self.compression['algorithm'] == 'heatshrink'
@@ -400,11 +413,14 @@ class FileTransferProtocol(object):
         data = open(filename, "rb").read()
         filesize = len(data)
 
-        self.open(dest_filename, compression, dummy)
+        settings = self.negotiate_compression(window) if compression else None
+        self.open(dest_filename, settings, dummy)
 
         block_size = self.protocol.block_size
         if compression:
-            data = heatshrink.encode(data, window_sz2=self.compression['window'], lookahead_sz2=self.compression['lookahead'])
+            window, lookahead = settings
+            print("Compression window: {0}, lookahead: {1}".format(window, lookahead))
+            data = heatshrink.encode(data, window_sz2=window, lookahead_sz2=lookahead)
 
         cratio = filesize / len(data)
 
@@ -0,0 +1,91 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * The simulator has no SD card. Tests that need media can use this RAM disk:
+ *
+ *   RamDisk disk;
+ *   DiskIODriver * const saved = card.diskIODriver();
+ *   card.changeMedia(&disk);
+ *   ...
+ *   card.release();
+ *   card.changeMedia(saved);
+ */
+
+#include <src/sd/cardreader.h>
+
+#include <string.h>
+#include <vector>
+
+// A freshly formatted FAT16 volume in RAM
+class RamDisk : public DiskIODriver {
+public:
+  static constexpr uint32_t blocks = 4250;  // 4200 one-block clusters, just over the FAT16 minimum
+
+  RamDisk() : image(blocks * 512) {
+    uint8_t * const boot = &image[0];
+    auto put16 = [](uint8_t * const p, const uint16_t v) { p[0] = v & 0xFF; p[1] = v >> 8; };
+    boot[0] = 0xEB; boot[1] = 0x3C; boot[2] = 0x90;
+    put16(boot + 11, 512);      // Bytes per sector
+    boot[13] = 1;               // Sectors per cluster
+    put16(boot + 14, 1);        // Reserved sectors
+    boot[16] = 1;               // FAT count
+    put16(boot + 17, 512);      // Root directory entries
+    put16(boot + 19, blocks);   // Total sectors
+    boot[21] = 0xF8;            // Media type
+    put16(boot + 22, 17);       // Sectors per FAT
+    boot[510] = 0x55; boot[511] = 0xAA;
+    uint8_t * const fat = &image[512];
+    fat[0] = 0xF8; fat[1] = fat[2] = fat[3] = 0xFF;
+  }
+
+  bool init(const uint8_t, const pin_t) override { return true; }
+  bool readCSD(csd_t * const) override { return false; }
+
+  bool readStart(const uint32_t block) override { next = block; return block < blocks; }
+  bool readData(uint8_t * const dst) override { return readBlock(next++, dst); }
+  bool readStop() override { return true; }
+
+  bool writeStart(const uint32_t block, const uint32_t) override { next = block; return block < blocks; }
+  bool writeData(const uint8_t *src) override { return writeBlock(next++, src); }
+  bool writeStop() override { return true; }
+
+  bool readBlock(const uint32_t block, uint8_t * const dst) override {
+    if (block >= blocks) return false;
+    memcpy(dst, &image[block * 512], 512);
+    return true;
+  }
+  bool writeBlock(const uint32_t block, const uint8_t * const src) override {
+    if (block >= blocks) return false;
+    memcpy(&image[block * 512], src, 512);
+    return true;
+  }
+
+  uint32_t cardSize() override { return blocks; }
+  bool isReady() override { return true; }
+  void idle() override {}
+
+private:
+  std::vector<uint8_t> image;
+  uint32_t next = 0;
+};